@@ -7,6 +7,7 @@
 #include "NvBlastTypes.h"
 #include "blast-sdk/extensions/serialization/NvBlastExtSerialization.h"
 #include "blast-sdk/extensions/serialization/NvBlastExtLlSerialization.h"
+#include "blast-sdk/extensions/shaders/NvBlastExtDamageShaders.h"
 #include "NvBlast.h"
 #include "blast-sdk/globals/NvBlastGlobals.h"
 
@@ -86,7 +87,18 @@ void UBlastAsset::DeserializeRawAsset()
 
 	// Load Asset from raw data
 	int32 BulkDataSize = RawAssetData.GetBulkDataSize();
-	if (BulkDataSize > 0)
+	if (BulkDataSize > 0 && bRawAssetDataIsLLAsset)
+	{
+#if WITH_EDITOR
+		LoadedAsset = TSharedPtr<NvBlastAsset>(TakeCookedLLAsset(), [](NvBlastAsset* asset)
+			{
+				NVBLAST_FREE((void*)asset);
+			});
+#else
+		Asset = TakeCookedLLAsset();
+#endif
+	}
+	else if (BulkDataSize > 0)
 	{
 		const void* DataPtr = RawAssetData.LockReadOnly();
 		if (DataPtr)
@@ -126,9 +138,43 @@ void UBlastAsset::DeserializeRawAsset()
 	Update();
 }
 
+NvBlastAsset* UBlastAsset::TakeCookedLLAsset()
+{
+	const int64 BulkDataSize = RawAssetData.GetBulkDataSize();
+
+	// Take over the loaded bulk data buffer, the NvBlastAsset is a single relocatable block so it can be used where it is
+	void* Data = nullptr;
+	RawAssetData.GetCopy(&Data, true);
+	if (Data == nullptr)
+	{
+		return nullptr;
+	}
+
+	// The Blast allocator is FMemory as well, so the buffer can be released with NVBLAST_FREE like any other asset
+	if (!IsAligned(Data, 16))
+	{
+		void* AlignedData = NVBLAST_ALLOC(BulkDataSize);
+		FMemory::Memcpy(AlignedData, Data, BulkDataSize);
+		FMemory::Free(Data);
+		Data = AlignedData;
+	}
+
+	NvBlastAsset* LLAsset = static_cast<NvBlastAsset*>(Data);
+	if (BulkDataSize < (int64)sizeof(NvBlastDataBlock) || NvBlastAssetGetSize(LLAsset, Nv::Blast::logLL) != BulkDataSize)
+	{
+		UE_LOG(LogBlast, Error, TEXT("Cooked NvBlastAsset data of '%s' is corrupt."), *GetPathName());
+		NVBLAST_FREE(Data);
+		return nullptr;
+	}
+	return LLAsset;
+}
 
 void UBlastAsset::Update()
 {
+	SharedDamageAccelerator.Reset();
+	PristineFamilyImage.Empty();
+	PristineFamilyImageAsset = nullptr;
+
 	// Fill RootChunks with chunk indices
 	RootChunks.Reset();
 
@@ -158,6 +204,73 @@ void UBlastAsset::Update()
 	BuildChunkMaxDepth();
 }
 
+TSharedPtr<NvBlastExtDamageAccelerator> UBlastAsset::AcquireDamageAccelerator()
+{
+	TSharedPtr<NvBlastExtDamageAccelerator> DamageAccelerator = SharedDamageAccelerator.Pin();
+	if (!DamageAccelerator.IsValid() && DamageAcceleratorType != EBlastDamageAcceleratorType::None && IsLoadedAssetValid())
+	{
+		NvBlastExtDamageAccelerator* NewAccelerator = NvBlastExtDamageAcceleratorCreate(GetLoadedAsset(), static_cast<int>(DamageAcceleratorType));
+		if (NewAccelerator)
+		{
+			DamageAccelerator = TSharedPtr<NvBlastExtDamageAccelerator>(NewAccelerator, [](NvBlastExtDamageAccelerator* accelerator)
+				{
+					accelerator->release();
+				});
+			SharedDamageAccelerator = DamageAccelerator;
+		}
+	}
+	return DamageAccelerator;
+}
+
+const TArray<uint8>& UBlastAsset::GetPristineFamilyImage()
+{
+	const NvBlastAsset* LLBlastAsset = GetLoadedAsset();
+	if (PristineFamilyImageAsset != LLBlastAsset)
+	{
+		PristineFamilyImage.Empty();
+		PristineFamilyImageAsset = LLBlastAsset;
+		if (LLBlastAsset)
+		{
+			const uint32 FamilySize = NvBlastAssetGetFamilyMemorySize(LLBlastAsset, Nv::Blast::logLL);
+			void* FamilyMem = NVBLAST_ALLOC(FamilySize);
+			NvBlastFamily* Family = NvBlastAssetCreateFamily(FamilyMem, LLBlastAsset, Nv::Blast::logLL);
+
+			// Everything in the family memory is relative to it except the asset pointer, which is the same for every copy
+			if (Family && CreateFirstActor(Family))
+			{
+				PristineFamilyImage.Append(static_cast<const uint8*>(FamilyMem), FamilySize);
+			}
+			NVBLAST_FREE(FamilyMem);
+		}
+	}
+	return PristineFamilyImage;
+}
+
+NvBlastActor* UBlastAsset::CreateFirstActor(NvBlastFamily* Family)
+{
+	NvBlastActorDesc ActorDesc;
+	ActorDesc.uniformInitialBondHealth = 1.0f;
+	ActorDesc.uniformInitialLowerSupportChunkHealth = 1.0f;
+	ActorDesc.initialBondHealths = nullptr;
+	ActorDesc.initialSupportChunkHealths = nullptr;
+	TArray<uint8> Scratch;
+	Scratch.SetNumUninitialized(NvBlastFamilyGetRequiredScratchForCreateFirstActor(Family, Nv::Blast::logLL) + 0x10); // add 16 to ensure alignment bumping doesn't overwrite
+	return NvBlastFamilyCreateFirstActor(Family, &ActorDesc, Scratch.GetData(), Nv::Blast::logLL);
+}
+
+#if WITH_EDITOR
+void UBlastAsset::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UBlastAsset, DamageAcceleratorType))
+	{
+		// Families created from now on use the new type
+		SharedDamageAccelerator.Reset();
+	}
+}
+#endif
+
 NvBlastAsset* UBlastAsset::GetLoadedAsset() const
 {
 #if WITH_EDITOR
@@ -305,9 +418,10 @@ enum EBlastAssetDataFormatVersion
 {
 	EBlastAssetDataFormatVersion_Initial = 1,
 	EBlastAssetDataFormatVersion_AddedAssetGUID,
+	EBlastAssetDataFormatVersion_CookedLLAsset,
 };
 
-FCustomVersionRegistration GRegisterUBlastAssetDataFormat(BlastAssetDataFormatGUID, EBlastAssetDataFormatVersion_AddedAssetGUID, TEXT("BlastAssetVer"));
+FCustomVersionRegistration GRegisterUBlastAssetDataFormat(BlastAssetDataFormatGUID, EBlastAssetDataFormatVersion_CookedLLAsset, TEXT("BlastAssetVer"));
 
 void UBlastAsset::Serialize(FArchive& Ar)
 {
@@ -327,6 +441,12 @@ void UBlastAsset::Serialize(FArchive& Ar)
 			AssetGUID = FGuid::NewGuid();
 		}
 
+		bRawAssetDataIsLLAsset = false;
+		if (ArchiveVersion >= EBlastAssetDataFormatVersion_CookedLLAsset)
+		{
+			Ar << bRawAssetDataIsLLAsset;
+		}
+
 		if (ArchiveVersion >= EBlastAssetDataFormatVersion_Initial)
 		{
 			RawAssetData.Serialize(Ar, this);
@@ -334,11 +454,34 @@ void UBlastAsset::Serialize(FArchive& Ar)
 	}
 	else
 	{
-		if (Ar.IsCooking())
+		bool bWriteLLAsset = false;
+#if WITH_EDITOR
+		bWriteLLAsset = Ar.IsCooking() && IsLoadedAssetValid();
+#endif
+		Ar << bWriteLLAsset;
+
+		if (bWriteLLAsset)
 		{
+#if WITH_EDITOR
 			//We are writing a cooked asset, the code will only ever call DeserializeRawAsset once during post load
-			RawAssetData.SetBulkDataFlags(BULKDATA_ForceInlinePayload | BULKDATA_SingleUse);
+			const NvBlastAsset* LLAsset = GetLoadedAsset();
+			const uint32 LLAssetSize = NvBlastAssetGetSize(LLAsset, Nv::Blast::logLL);
+			CookedLLAssetData.SetBulkDataFlags(BULKDATA_SerializeCompressed | BULKDATA_ForceInlinePayload | BULKDATA_SingleUse);
+			CookedLLAssetData.Lock(LOCK_READ_WRITE);
+			FMemory::Memcpy(CookedLLAssetData.Realloc(LLAssetSize), LLAsset, LLAssetSize);
+			CookedLLAssetData.Unlock();
+			CookedLLAssetData.Serialize(Ar, this);
+			CookedLLAssetData.RemoveBulkData();
+#endif
+		}
+		else
+		{
+			if (Ar.IsCooking())
+			{
+				//We are writing a cooked asset, the code will only ever call DeserializeRawAsset once during post load
+				RawAssetData.SetBulkDataFlags(BULKDATA_ForceInlinePayload | BULKDATA_SingleUse);
+			}
+			RawAssetData.Serialize(Ar, this);
 		}
-		RawAssetData.Serialize(Ar, this);
 	}
 }
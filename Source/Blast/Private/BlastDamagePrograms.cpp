@@ -15,6 +15,18 @@ BlastRadialDamageProgram::BlastRadialDamageProgram(float damage, float minRadius
 {
 }
 
+bool BlastRadialDamageProgram::IsSameDamageAs(const FBlastBaseDamageProgram& Other) const
+{
+	if (Other.GetProgramTypeName() != GetProgramTypeName())
+	{
+		return false;
+	}
+	const BlastRadialDamageProgram& OtherRadial = static_cast<const BlastRadialDamageProgram&>(Other);
+	return DamageType == Other.DamageType && Damage == OtherRadial.Damage && MinRadius == OtherRadial.MinRadius && MaxRadius == OtherRadial.MaxRadius
+		&& ImpulseStrength == OtherRadial.ImpulseStrength && bImpulseVelChange == OtherRadial.bImpulseVelChange
+		&& bRandomizeImpulse == OtherRadial.bRandomizeImpulse && ImpulseRandomizationDivider == OtherRadial.ImpulseRandomizationDivider;
+}
+
 bool BlastRadialDamageProgram::Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const
 {
 	const float normalizedDamage = input.material->GetNormalizedDamage(Damage);
@@ -54,6 +66,17 @@ BlastCapsuleDamageProgram::BlastCapsuleDamageProgram(float damage, float halfHei
 {
 }
 
+bool BlastCapsuleDamageProgram::IsSameDamageAs(const FBlastBaseDamageProgram& Other) const
+{
+	if (Other.GetProgramTypeName() != GetProgramTypeName())
+	{
+		return false;
+	}
+	const BlastCapsuleDamageProgram& OtherCapsule = static_cast<const BlastCapsuleDamageProgram&>(Other);
+	return DamageType == Other.DamageType && Damage == OtherCapsule.Damage && HalfHeight == OtherCapsule.HalfHeight && MinRadius == OtherCapsule.MinRadius
+		&& MaxRadius == OtherCapsule.MaxRadius && ImpulseStrength == OtherCapsule.ImpulseStrength && bImpulseVelChange == OtherCapsule.bImpulseVelChange;
+}
+
 bool BlastCapsuleDamageProgram::Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const
 {
 	FVector3f CapsuleDir = input.localRot.RotateVector(FVector3f::UpVector);
@@ -115,6 +138,17 @@ BlastShearDamageProgram::BlastShearDamageProgram(float damage, float minRadius,
 {
 }
 
+bool BlastShearDamageProgram::IsSameDamageAs(const FBlastBaseDamageProgram& Other) const
+{
+	if (Other.GetProgramTypeName() != GetProgramTypeName())
+	{
+		return false;
+	}
+	const BlastShearDamageProgram& OtherShear = static_cast<const BlastShearDamageProgram&>(Other);
+	return DamageType == Other.DamageType && Damage == OtherShear.Damage && MinRadius == OtherShear.MinRadius && MaxRadius == OtherShear.MaxRadius
+		&& ImpulseStrength == OtherShear.ImpulseStrength && bImpulseVelChange == OtherShear.bImpulseVelChange;
+}
+
 bool BlastShearDamageProgram::Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const
 {
 	const float normalizedDamage = input.material->GetNormalizedDamage(Damage);
@@ -6,6 +6,11 @@
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshModel.h"
 #include "UObject/ObjectSaveContext.h"
+#include "Async/ParallelFor.h"
+#include "Chaos/ChaosArchive.h"
+#include "Chaos/Convex.h"
+#include "Physics/Experimental/ChaosCooking.h"
+#include "Serialization/CustomVersion.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BlastMesh)
 
@@ -18,6 +23,62 @@
 
 #define LOCTEXT_NAMESPACE "Blast"
 
+//The value of this is not important, it's just used to tag our version code
+static FGuid BlastMeshDataFormatGUID(0x2E7C41B9, 0x8D5F4A06, 0xB31C72E5, 0x5A90D4F3);
+
+enum EBlastMeshDataFormatVersion
+{
+	EBlastMeshDataFormatVersion_Initial = 1,
+	EBlastMeshDataFormatVersion_FlattenedChunkCollision,
+	//Editor packages also keep the cooked convex meshes so loading doesn't cook them again
+	EBlastMeshDataFormatVersion_EditorConvexMeshes,
+
+	EBlastMeshDataFormatVersion_Latest = EBlastMeshDataFormatVersion_EditorConvexMeshes
+};
+
+FCustomVersionRegistration GRegisterUBlastMeshDataFormat(BlastMeshDataFormatGUID, EBlastMeshDataFormatVersion_Latest, TEXT("BlastMeshVer"));
+
+//Cooks the convex meshes of every chunk that doesn't have them yet, returns true if any were cooked
+static bool CookMissingConvexMeshes(TArray<FBlastCookedChunkData>& CookedChunkData)
+{
+	TArray<int32> ChunksToCook;
+	TArray<TUniquePtr<Chaos::FCookHelper>> CookHelpers;
+	for (int32 ChunkIndex = 0; ChunkIndex < CookedChunkData.Num(); ChunkIndex++)
+	{
+		const FBlastCookedChunkData& ChunkData = CookedChunkData[ChunkIndex];
+		if (!ChunkData.HasAllConvexMeshes())
+		{
+			//Only used to get the convex meshes cooked, and garbage afterwards
+			UBodySetup* CookingBodySetup = NewObject<UBodySetup>(GetTransientPackage(), NAME_None, RF_Transient);
+			CookingBodySetup->bGenerateMirroredCollision = false;
+			CookingBodySetup->AggGeom.ConvexElems = ChunkData.AggGeom.ConvexElems;
+			ChunksToCook.Add(ChunkIndex);
+			//Gathers the cook info from the body setup, so it has to be made on this thread too
+			CookHelpers.Add(MakeUnique<Chaos::FCookHelper>(CookingBodySetup));
+		}
+	}
+
+	//Cooking the convex hulls is the expensive part. Cook() is the part UBodySetup::CreatePhysicsMeshesAsync runs on a worker, it only works on the helper's own data
+	ParallelFor(CookHelpers.Num(), [&CookHelpers](int32 Index)
+	{
+		CookHelpers[Index]->Cook();
+	});
+
+	for (int32 Index = 0; Index < ChunksToCook.Num(); Index++)
+	{
+		UBodySetup* CookingBodySetup = CookHelpers[Index]->SourceSetup;
+		CookingBodySetup->FinishCreatePhysicsMeshesChaos(*CookHelpers[Index]);
+
+		FBlastCookedChunkData& ChunkData = CookedChunkData[ChunksToCook[Index]];
+		ChunkData.ConvexMeshes.Reset(CookingBodySetup->AggGeom.ConvexElems.Num());
+		for (const FKConvexElem& ConvexElem : CookingBodySetup->AggGeom.ConvexElems)
+		{
+			ChunkData.ConvexMeshes.Add(ConvexElem.GetChaosConvexMesh());
+		}
+	}
+	return ChunksToCook.Num() > 0;
+}
+
 UBlastMesh::UBlastMesh(const FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer),
 	Mesh(nullptr),
@@ -98,9 +159,34 @@ void UBlastMesh::PostLoad()
 
 	RebuildIndexToBoneNameMap();
 
+	if (ChunkBodySetupTemplate)
+	{
+		ChunkBodySetupTemplate->ConditionalPostLoad();
+	}
+
+#if !WITH_EDITOR
+	//Cooked packages normally carry every chunk's convex meshes so this does nothing. If some are missing cook them all here in parallel,
+	//otherwise every body made from those chunks would cook them again on its own when the actor splits
+	CookMissingConvexMeshes(CookedChunkData);
+#endif
+
 #if WITH_EDITOR
+	if (GetLinkerCustomVersion(BlastMeshDataFormatGUID) < EBlastMeshDataFormatVersion_FlattenedChunkCollision)
+	{
+		//The chunk collision used to live in a UBodySetup per chunk, which isn't loaded anymore
+		for (FBlastCookedChunkData& ChunkData : CookedChunkData)
+		{
+			ChunkData.SourceBodySetupGUID = FGuid();
+		}
+	}
+
 	// Make sure the order corresponds to that in the asset
 	RebuildCookedBodySetupsIfRequired();
+#endif
+
+	RebuildChunkPropertyTable();
+
+#if WITH_EDITOR
 
 	if (Mesh)
 	{
@@ -135,6 +221,44 @@ void UBlastMesh::PreSave(FObjectPreSaveContext SaveContext)
 	Super::PreSave(SaveContext);
 }
 
+void UBlastMesh::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(BlastMeshDataFormatGUID);
+	if (Ar.IsLoading() && Ar.CustomVer(BlastMeshDataFormatGUID) < EBlastMeshDataFormatVersion_FlattenedChunkCollision)
+	{
+		return;
+	}
+
+	//Saved whenever every chunk has them, editor packages included. Chunks without them are cooked in RebuildCookedBodySetupsIfRequired
+	bool bHasConvexMeshes = false;
+	if (Ar.IsSaving())
+	{
+		bHasConvexMeshes = true;
+		for (const FBlastCookedChunkData& ChunkData : CookedChunkData)
+		{
+			bHasConvexMeshes &= ChunkData.HasAllConvexMeshes();
+		}
+	}
+	Ar << bHasConvexMeshes;
+	if (bHasConvexMeshes)
+	{
+		Chaos::FChaosArchive ChaosAr(Ar);
+		int32 ChunkCount = CookedChunkData.Num();
+		ChaosAr << ChunkCount;
+		if (Ar.IsLoading() && ChunkCount != CookedChunkData.Num())
+		{
+			Ar.SetError();
+			return;
+		}
+		for (FBlastCookedChunkData& ChunkData : CookedChunkData)
+		{
+			ChaosAr << ChunkData.ConvexMeshes;
+		}
+	}
+}
+
 void UBlastMesh::RebuildIndexToBoneNameMap()
 {
 	// Building chunk to bone maps
@@ -158,6 +282,22 @@ void UBlastMesh::RebuildIndexToBoneNameMap()
 }
 
 #if WITH_EDITOR
+//Only the settings the chunk bodies take from ChunkBodySetupTemplate. The shapes and the physical material are kept per chunk
+static bool ChunkBodySettingsMatch(const UBodySetup* A, const UBodySetup* B)
+{
+	const FBodyInstance& InstA = A->DefaultInstance;
+	const FBodyInstance& InstB = B->DefaultInstance;
+	return A->CollisionTraceFlag == B->CollisionTraceFlag
+		&& A->CollisionReponse == B->CollisionReponse
+		&& A->PhysicsType == B->PhysicsType
+		&& A->bDoubleSidedGeometry == B->bDoubleSidedGeometry
+		&& A->bConsiderForBounds == B->bConsiderForBounds
+		&& InstA.GetCollisionProfileName() == InstB.GetCollisionProfileName()
+		&& InstA.GetCollisionEnabled(false) == InstB.GetCollisionEnabled(false)
+		&& InstA.GetObjectType() == InstB.GetObjectType()
+		&& InstA.GetResponseToChannels() == InstB.GetResponseToChannels();
+}
+
 void UBlastMesh::RebuildCookedBodySetupsIfRequired(bool bForceRebuild)
 {
 	int32 BoneCount = IsValidBlastMesh() ? Mesh->GetRefSkeleton().GetRawBoneNum() : 0;
@@ -177,6 +317,10 @@ void UBlastMesh::RebuildCookedBodySetupsIfRequired(bool bForceRebuild)
 		CookedChunkData.SetNum(ChunkCount);
 	}
 
+	bool bChunkDataChanged = bForceRebuild || ChunkProperties.Num() != ChunkCount;
+	const UBodySetup* TemplateSource = nullptr;
+	int32 MismatchedChunkCount = 0;
+	FName FirstMismatchedBone;
 	for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ChunkIndex++)
 	{
 		FBlastCookedChunkData& CurCookedChunkData = CookedChunkData[ChunkIndex];
@@ -189,21 +333,29 @@ void UBlastMesh::RebuildCookedBodySetupsIfRequired(bool bForceRebuild)
 			//Transform these ahead of time and cache since InitialBoneTransform is constant
 			//Always make the initial actor at the component space origin, this allows the actor space to correspond to the at-rest position which Blast internally uses
 			USkeletalBodySetup* PhysicsAssetBodySetup = PhysicsAsset->SkeletalBodySetups[BodySetupIndex];
+
+			//Every chunk body gets its settings from the one template, which always comes from the lowest chunk that has a body so it doesn't depend on which chunks got rebuilt
+			if (TemplateSource == nullptr)
+			{
+				TemplateSource = PhysicsAssetBodySetup;
+			}
+			else if (!ChunkBodySettingsMatch(TemplateSource, PhysicsAssetBodySetup))
+			{
+				if (MismatchedChunkCount++ == 0)
+				{
+					FirstMismatchedBone = PhysicsAssetBodySetup->BoneName;
+				}
+			}
 			//Whenever this setup is changed the guid is changed
 			if (bForceRebuild || CurCookedChunkData.SourceBodySetupGUID != PhysicsAssetBodySetup->BodySetupGuid)
 			{
 				//rebuild this one
-				UBodySetup* CookedTransformedBodySetup = NewObject<UBodySetup>(this);
-				CookedTransformedBodySetup->bGenerateMirroredCollision = false;
-				//Copy the settings, but not the actual colliders
-				CookedTransformedBodySetup->CopyBodySetupProperty(PhysicsAssetBodySetup);
-				//We are on the root bone now
-				CookedTransformedBodySetup->BoneName = NAME_None;
+				CurCookedChunkData.PhysMaterial = PhysicsAssetBodySetup->PhysMaterial;
 
 				//Copy the bodies, transforming them into bone-space
 				const FTransform InitialBoneTransform = GetComponentSpaceInitialBoneTransform(BoneIndex);
 				const FKAggregateGeom& SrcAggGeom = PhysicsAssetBodySetup->AggGeom;
-				FKAggregateGeom& DestAggGeom = CookedTransformedBodySetup->AggGeom;
+				FKAggregateGeom& DestAggGeom = CurCookedChunkData.AggGeom;
 
 				DestAggGeom.SphereElems.Reset(SrcAggGeom.SphereElems.Num());
 				for (auto& E : SrcAggGeom.SphereElems)
@@ -233,18 +385,53 @@ void UBlastMesh::RebuildCookedBodySetupsIfRequired(bool bForceRebuild)
 					Last.BakeTransformToVerts();
 				}
 
-				CookedTransformedBodySetup->CreatePhysicsMeshes();
-
-				CurCookedChunkData.CookedBodySetup = CookedTransformedBodySetup;
+				CurCookedChunkData.ConvexMeshes.Reset();
 				CurCookedChunkData.SourceBodySetupGUID = PhysicsAssetBodySetup->BodySetupGuid;
+				DormantBodySetup = nullptr;
+				bChunkDataChanged = true;
 			}
 		}
 		else
 		{
 			//Clear out this entry
+			bChunkDataChanged |= CurCookedChunkData.SourceBodySetupGUID.IsValid();
 			CurCookedChunkData.SourceBodySetupGUID = FGuid();
-			CurCookedChunkData.CookedBodySetup = nullptr;
+			CurCookedChunkData.AggGeom = FKAggregateGeom();
+			CurCookedChunkData.PhysMaterial = nullptr;
+			CurCookedChunkData.ConvexMeshes.Reset();
+			DormantBodySetup = nullptr;
+		}
+	}
+
+	if (TemplateSource && (bChunkDataChanged || ChunkBodySetupTemplate == nullptr))
+	{
+		if (ChunkBodySetupTemplate == nullptr)
+		{
+			ChunkBodySetupTemplate = NewObject<UBodySetup>(this);
 		}
+		//Copy the settings, but not the actual colliders
+		ChunkBodySetupTemplate->CopyBodySetupProperty(TemplateSource);
+		ChunkBodySetupTemplate->bGenerateMirroredCollision = false;
+		//We are on the root bone now
+		ChunkBodySetupTemplate->BoneName = NAME_None;
+		DormantBodySetup = nullptr;
+	}
+
+	if (MismatchedChunkCount > 0)
+	{
+		UE_LOG(LogBlast, Warning, TEXT("%s: %d chunk bodies in %s (first: %s) have different collision or physics settings than %s, whose settings are used for all of them."),
+			*GetPathName(), MismatchedChunkCount, *GetPathNameSafe(PhysicsAsset), *FirstMismatchedBone.ToString(), *TemplateSource->BoneName.ToString());
+	}
+
+	//Also needed after loading packages saved without them
+	if (CookMissingConvexMeshes(CookedChunkData))
+	{
+		DormantBodySetup = nullptr;
+	}
+
+	if (bChunkDataChanged)
+	{
+		RebuildChunkPropertyTable();
 	}
 }
 
@@ -363,6 +550,62 @@ const TArray<FBlastCookedChunkData>& UBlastMesh::GetCookedChunkData_AssumeUpToDa
 	return CookedChunkData;
 }
 
+void UBlastMesh::RebuildChunkPropertyTable()
+{
+	const int32 ChunkCount = IsLoadedAssetValid() ? GetChunkCount() : 0;
+	ChunkProperties.Volumes.SetNumUninitialized(ChunkCount);
+	ChunkProperties.MassFractions.SetNumUninitialized(ChunkCount);
+	ChunkProperties.LocalBounds.SetNumUninitialized(ChunkCount);
+	ChunkProperties.Depths.SetNumUninitialized(ChunkCount);
+
+	float TotalVolume = 0.f;
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ChunkIndex++)
+	{
+		const float Volume = ChunkMeshVolumes.IsValidIndex(ChunkIndex) ? ChunkMeshVolumes[ChunkIndex] : 0.f;
+		ChunkProperties.Volumes[ChunkIndex] = Volume;
+		if (ChunkIndex > 0)
+		{
+			TotalVolume += Volume;
+		}
+		ChunkProperties.LocalBounds[ChunkIndex] = CookedChunkData.IsValidIndex(ChunkIndex) ? CookedChunkData[ChunkIndex].AggGeom.CalcAABB(FTransform::Identity) : FBox(ForceInit);
+		ChunkProperties.Depths[ChunkIndex] = GetChunkDepth(ChunkIndex);
+	}
+
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ChunkIndex++)
+	{
+		ChunkProperties.MassFractions[ChunkIndex] = TotalVolume > 0.f ? ChunkProperties.Volumes[ChunkIndex] / TotalVolume : 0.f;
+	}}
+
+UBodySetup* UBlastMesh::GetDormantBodySetup()
+{
+	const TArray<FBlastCookedChunkData>& CookedData = GetCookedChunkData();
+	if (DormantBodySetup == nullptr)
+	{
+		//Same collision the first actor of a new family gets, the root chunks are its visible chunks
+		UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+		bool bFirstChunk = true;
+		for (uint32 ChunkIndex : GetRootChunks())
+		{
+			if (!CookedData.IsValidIndex(ChunkIndex) || !CookedData[ChunkIndex].HasCollision())
+			{
+				continue;
+			}
+
+			if (bFirstChunk)
+			{
+				CookedData[ChunkIndex].PopulateBodySetup(NewBodySetup, ChunkBodySetupTemplate);
+				bFirstChunk = false;
+			}
+			else
+			{
+				CookedData[ChunkIndex].AppendToBodySetup(NewBodySetup);
+			}
+		}
+		DormantBodySetup = NewBodySetup;
+	}
+	return DormantBodySetup;
+}
+
 const FString UBlastMesh::ChunkPrefix = TEXT("chunk_");
 
 FName UBlastMesh::GetDefaultChunkBoneNameFromIndex(int32 ChunkIndex)
@@ -371,70 +614,33 @@ FName UBlastMesh::GetDefaultChunkBoneNameFromIndex(int32 ChunkIndex)
 }
 
 
-void FBlastCookedChunkData::PopulateBodySetup(UBodySetup* NewBodySetup) const
+void FBlastCookedChunkData::PopulateBodySetup(UBodySetup* NewBodySetup, const UBodySetup* BodySetupTemplate) const
 {
 	//These should already be null but just incase
 	NewBodySetup->ClearPhysicsMeshes();
 
-	//Make sure they are loaded
-	CookedBodySetup->CreatePhysicsMeshes();
+	//The template has no shapes, so this only takes the settings
+	NewBodySetup->CopyBodyPropertiesFrom(BodySetupTemplate);
+	NewBodySetup->PhysMaterial = PhysMaterial;
+	NewBodySetup->AddCollisionFrom(AggGeom);
 
-	//The assignment operators clear these so make sure we cache them before we touch the arrays
-	ConvexMeshTempList ConvexMeshes;
-	for (auto& C : CookedBodySetup->AggGeom.ConvexElems)
-	{
-#if BLAST_USE_PHYSX
-		physx::PxConvexMesh* Mesh = C.GetConvexMesh();
-		if (Mesh)
-		{
-			Mesh->acquireReference();
-		}
-		ConvexMeshes.Add(Mesh);
-#else
-		ConvexMeshes.Add(C.GetChaosConvexMesh());
-#endif
-	}
-
-	NewBodySetup->CopyBodyPropertiesFrom(CookedBodySetup);
-
-	UpdateAfterShapesAdded(NewBodySetup, ConvexMeshes);
+	UpdateAfterShapesAdded(NewBodySetup, ConvexMeshTempList(ConvexMeshes));
 }
 
 void FBlastCookedChunkData::AppendToBodySetup(UBodySetup* NewBodySetup) const
 {
-	//Make sure they are loaded
-	CookedBodySetup->CreatePhysicsMeshes();
-
 	//The assignment operators clear these so make sure we cache them before we touch the arrays
-	ConvexMeshTempList ConvexMeshes;
+	ConvexMeshTempList NewConvexMeshes;
 	for (auto& C : NewBodySetup->AggGeom.ConvexElems)
 	{
-#if BLAST_USE_PHYSX
-		//Already add-refed these before
-		ConvexMeshes.Add(C.GetConvexMesh());
-#else
-		ConvexMeshes.Add(C.GetChaosConvexMesh());
-#endif
-	}
-
-	for (const auto& C : CookedBodySetup->AggGeom.ConvexElems)
-	{
-#if BLAST_USE_PHYSX
-		physx::PxConvexMesh* Mesh = C.GetConvexMesh();
-		if (Mesh)
-		{
-			Mesh->acquireReference();
-		}
-		ConvexMeshes.Add(Mesh);
-#else
-		ConvexMeshes.Add(C.GetChaosConvexMesh());
-#endif
+		NewConvexMeshes.Add(C.GetChaosConvexMesh());
 	}
+	NewConvexMeshes.Append(ConvexMeshes);
 
 	//Should we check the PhysicalMaterial, etc are the same
-	NewBodySetup->AddCollisionFrom(CookedBodySetup);
+	NewBodySetup->AddCollisionFrom(AggGeom);
 
-	UpdateAfterShapesAdded(NewBodySetup, MoveTemp(ConvexMeshes));
+	UpdateAfterShapesAdded(NewBodySetup, MoveTemp(NewConvexMeshes));
 }
 
 void FBlastCookedChunkData::UpdateAfterShapesAdded(UBodySetup* NewBodySetup, ConvexMeshTempList ConvexMeshes)
@@ -452,11 +658,7 @@ void FBlastCookedChunkData::UpdateAfterShapesAdded(UBodySetup* NewBodySetup, Con
 			break;
 		}
 
-#if BLAST_USE_PHYSX
-		New.SetConvexMesh(ConvexMeshes[C]);
-#else
 		New.SetConvexMeshObject(MoveTemp(ConvexMeshes[C]));
-#endif
 	}
 
 	//If any are missing we need to fallback to runtime cooking
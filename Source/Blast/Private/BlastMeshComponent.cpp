@@ -14,6 +14,9 @@
 #include "Misc/UObjectToken.h"
 #include "EngineUtils.h"
 #include "Rendering/SkeletalMeshRenderData.h"
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
+#include "HAL/IConsoleManager.h"
 
 #include "BlastGlobals.h"
 #include "BlastExtendedSupport.h"
@@ -21,6 +24,7 @@
 #include "BlastModule.h"
 #include "BlastDamagePrograms.h"
 #include "BlastGlueVolume.h"
+#include "BlastStressSolverSubsystem.h"
 
 #include "NvBlast.h"
 #include "NvBlastTypes.h"
@@ -36,6 +40,7 @@
 #include "Chaos/ChaosScene.h"
 #include "Physics/Experimental/ChaosScopedSceneLock.h"
 #include "Physics/Experimental/PhysScene_Chaos.h"
+#include "Physics/PhysicsInterfaceCore.h"
 #include "PBDRigidsSolver.h"
 #endif
 
@@ -45,6 +50,37 @@ DECLARE_CYCLE_STAT(TEXT("Calc BlastMeshComponent Bounds"), STAT_BlastMeshCompone
 DECLARE_CYCLE_STAT(TEXT("Sync Chunks and Bodies"), STAT_BlastMeshComponent_SyncChunksAndBodies, STATGROUP_Blast);
 DECLARE_CYCLE_STAT(TEXT("Sync Chunks and Bodies (Non-rendering children update)"),
                    STAT_BlastMeshComponent_SyncChunksAndBodiesChildren, STATGROUP_Blast);
+DECLARE_CYCLE_STAT(TEXT("Generate Overlap Fracture"), STAT_BlastMeshComponent_GenerateOverlapFracture, STATGROUP_Blast);
+DECLARE_CYCLE_STAT(TEXT("Process Queued Damage"), STAT_BlastMeshComponent_ProcessQueuedDamage, STATGROUP_Blast);
+DECLARE_CYCLE_STAT(TEXT("Async Stress Solver Update"), STAT_BlastMeshComponent_AsyncStressSolverUpdate, STATGROUP_Blast);
+
+static TAutoConsoleVariable<bool> CVarBlastSleepAwareBoneSync(
+	TEXT("blast.SleepAwareBoneSync"),
+	true,
+	TEXT("Only sync the bones of Blast actors whose bodies are awake. When off every body is polled each frame."));
+
+static TAutoConsoleVariable<int32> CVarBlastParallelBoneSyncMinChunks(
+	TEXT("blast.ParallelBoneSyncMinChunks"),
+	2048,
+	TEXT("Number of moving chunks in a Blast component above which their bone transforms are written on worker threads."));
+
+// Fracture commands for one actor, generated on a worker thread and applied later on the game thread
+struct FBlastPendingFracture
+{
+	UBlastMeshComponent* Component = nullptr;
+	uint32 ActorIndex = 0;
+	// BlastActorGenerations[ActorIndex] when the commands were generated, NvBlast may hand the same pointer to a later actor in this slot
+	uint32 ActorGeneration = 0;
+	NvBlastActor* BlastActor = nullptr;
+	FBodyInstance* BodyInstance = nullptr;
+	FBlastBaseDamageProgram::FInput Input;
+	bool bGenerated = false;
+	TArray<NvBlastBondFractureData> BondFractures;
+	TArray<NvBlastChunkFractureData> ChunkFractures;
+};
+
+// When set, ExecuteBlastDamageProgram on this thread only generates commands into it
+static thread_local FBlastPendingFracture* GBlastFractureCapture = nullptr;
 
 UBlastMeshComponent::UBlastMeshComponent(const FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer),
@@ -60,6 +96,8 @@ UBlastMeshComponent::UBlastMeshComponent(const FObjectInitializer& ObjectInitial
 	bCrumbleInmostChunks(false),
 	bShouldAllChildrenChunksBeSmallChunks(false),
 	bBindOnHitDelegate(false),
+	QueuedDamageBudgetMs(0.f),
+	bDeferFamilyCreation(false),
 	bOverride_BlastMaterial(false),
 	bOverride_StressProperties(false),
 	bOverride_DebrisProperties(false),
@@ -272,11 +310,28 @@ NvBlastActor* UBlastMeshComponent::DeserializeActor(const TArray<uint8>& InData,
 	return NvBlastFamilyDeserializeActor(BlastFamily.Get(), InData.GetData() + DataOffset, Nv::Blast::logLL);
 }
 
-void UBlastMeshComponent::InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset)
+NvBlastActor* UBlastMeshComponent::InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset)
 {
-	void* FamilyMem = NVBLAST_ALLOC(NvBlastAssetGetFamilyMemorySize(LLBlastAsset, Nv::Blast::logLL));
-	// Create a NvBlastFamily and wrap it in a shared ptr with a custom deleter so it gets released when we're done with it.
-	BlastFamily = TSharedPtr<NvBlastFamily>(NvBlastAssetCreateFamily(FamilyMem, LLBlastAsset, Nv::Blast::logLL),
+	const uint32 FamilySize = NvBlastAssetGetFamilyMemorySize(LLBlastAsset, Nv::Blast::logLL);
+	void* FamilyMem = NVBLAST_ALLOC(FamilySize);
+
+	// Every undamaged family of the asset is the same, so copy the one the asset keeps rather than building it again
+	const TArray<uint8>& PristineFamilyImage = GetBlastAsset()->GetPristineFamilyImage();
+	const bool bFromPristineImage = PristineFamilyImage.Num() == FamilySize;
+	NvBlastFamily* Family;
+	if (bFromPristineImage)
+	{
+		FMemory::Memcpy(FamilyMem, PristineFamilyImage.GetData(), FamilySize);
+		Family = static_cast<NvBlastFamily*>(FamilyMem);
+		NvBlastFamilySetAsset(Family, LLBlastAsset, Nv::Blast::logLL);
+	}
+	else
+	{
+		Family = NvBlastAssetCreateFamily(FamilyMem, LLBlastAsset, Nv::Blast::logLL);
+	}
+
+	// Wrap the NvBlastFamily in a shared ptr with a custom deleter so it gets released when we're done with it.
+	BlastFamily = TSharedPtr<NvBlastFamily>(Family,
 											[FamilyMem](NvBlastFamily* family)
 											{
 												NVBLAST_FREE((void*)FamilyMem);
@@ -285,13 +340,17 @@ void UBlastMeshComponent::InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset)
 
 	uint32 MaxActorCount = NvBlastFamilyGetMaxActorCount(BlastFamily.Get(), Nv::Blast::logLL);
 	BlastActors.SetNum(MaxActorCount);
+	BlastActorGenerations.SetNumZeroed(MaxActorCount);
 	ActorBodySetups.Reset();
 	//In some cases due to the editor duplicating objects this can be not empty so make sure it's zeroed out
 	ActorBodySetups.SetNumZeroed(MaxActorCount);
 	BlastActorsBeginLive = 0;
 	BlastActorsEndLive = 0;
+	AwakeActors.Reset();
+	bSyncAllActors = true;
+	bActorsWorldBoundsValid = false;
 
-	DamageAccelerator = NvBlastExtDamageAcceleratorCreate(LLBlastAsset, 3);
+	DamageAccelerator = GetBlastAsset()->AcquireDamageAccelerator();
 
 	// Create stress solver if enabled (right after actor created, but before 'StressSolver->notifyActorCreated()' call)
 	if (GetUsedStressProperties().bCalculateStress)
@@ -300,7 +359,28 @@ void UBlastMeshComponent::InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset)
 		const float density = 0.000001f; // 1e-6 kg / cm3
 		// TODO: set each node according to its mass, volume and local transform with setNodeInfo
 		StressSolver->setAllNodesInfoFromLL(density);
+		bStressSolverInputChanged = true;
+		AppliedStressSolverIterations = 0;
+		StressSolverLastError = 0.f;
+		StressSolverOverstressRatio = 0.f;
+
+		UWorld* World = GetWorld();
+		if (UBlastStressSolverSubsystem* StressSolverSubsystem = World ? World->GetSubsystem<UBlastStressSolverSubsystem>() : nullptr)
+		{
+			StressSolverSubsystem->RegisterComponent(this);
+		}
+	}
+
+	NvBlastActor* FirstActor = nullptr;
+	if (bFromPristineImage)
+	{
+		NvBlastFamilyGetActors(&FirstActor, 1, Family, Nv::Blast::logLL);
 	}
+	else
+	{
+		FirstActor = UBlastAsset::CreateFirstActor(Family);
+	}
+	return FirstActor;
 }
 
 void UBlastMeshComponent::InitBlastFamily()
@@ -328,28 +408,125 @@ void UBlastMeshComponent::InitBlastFamily()
 	bChunkVisibilityChanged = true;
 	DebrisCount = 0;
 
-	InitBlastFamilyInternal(LLBlastAsset);
+	NvBlastActor* FirstActor = InitBlastFamilyInternal(LLBlastAsset);
 
 #if WITH_EDITOR
 	BlastMesh->RebuildCookedBodySetupsIfRequired();
 #endif
 
-	SetupNewBlastActor(CreateFirstActor(), FBlastActorCreateInfo(GetComponentTransform()), nullptr, nullptr, FName(), true);
+	// The first actor covers the whole asset, so this is as large as the split buffers will get
+	UpdateSplitScratchSize(FirstActor);
+	SetupNewBlastActor(FirstActor, FBlastActorCreateInfo(GetComponentTransform()), nullptr, nullptr, FName(), true);
 
 	bAddedOrRemovedActorSinceLastRefresh = true;
 	bHasValidBoneTransform = false;
 
-	UpdateFractureBufferSize();
 	MarkRenderDynamicDataDirty();
 }
 
+bool UBlastMeshComponent::CanDeferFamilyCreation() const
+{
+	UWorld* World = GetWorld();
+	const UBlastAsset* BlastAsset = GetBlastAsset();
+	if (!bDeferFamilyCreation || !World || !World->IsGameWorld() || !BlastAsset || OwningSupportStructureIndex != INDEX_NONE
+		|| GetUsedStressProperties().bCalculateStress)
+	{
+		return false;
+	}
+
+	//The dormant body is kinematic, so it can only stand in for a first actor which is kinematic too
+	if (bIsInitiallyKinematic || ModifiedAsset != nullptr)
+	{
+		return true;
+	}
+	for (uint32 ChunkIndex : BlastAsset->GetRootChunks())
+	{
+		if (BlastAsset->IsChunkStatic(ChunkIndex))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UBlastMeshComponent::InitBlastFamilyOrDormantBody()
+{
+	if (CanDeferFamilyCreation())
+	{
+		InitDormantBody();
+	}
+	else
+	{
+		InitBlastFamily();
+	}
+}
+
+void UBlastMeshComponent::InitDormantBody()
+{
+	check(!BlastFamily.IsValid() && DormantBodyInstance == nullptr);
+
+	//Shared by every dormant component using this mesh, so it has no bone name. OnHit resolves hits on it to the first actor
+	UBodySetup* DormantBodySetup = BlastMesh->GetDormantBodySetup();
+
+	DormantBodyInstance = AcquireBodyInstance();
+	DormantBodyInstance->CopyBodyInstancePropertiesFrom(&BodyInstance);
+	DormantBodyInstance->bSimulatePhysics = false;
+	DormantBodyInstance->InstanceBodyIndex = 0;
+	DormantBodyInstance->InitBody(DormantBodySetup, GetComponentTransform(), this, GetWorld()->GetPhysicsScene());
+	DormantBodyInstance->UpdateMassProperties();
+
+	//The root chunks shown in OnRegister are already what the first actor would show
+	bAddedOrRemovedActorSinceLastRefresh = true;
+	bHasValidBoneTransform = false;
+	MarkRenderDynamicDataDirty();
+}
+
+void UBlastMeshComponent::TermDormantBody()
+{
+	if (DormantBodyInstance)
+	{
+		//The first actor picks this up from the pool when the family is created
+		ReleaseBodyToPool(DormantBodyInstance, nullptr);
+		DormantBodyInstance = nullptr;
+	}
+}
+
+bool UBlastMeshComponent::EnsureBlastFamily()
+{
+	if (DormantBodyInstance)
+	{
+		TermDormantBody();
+		InitBlastFamily();
+	}
+	return BlastFamily.IsValid();
+}
+
+int32 UBlastMeshComponent::WakeForDamage(int32 ItemIndex)
+{
+	if (DormantBodyInstance == nullptr)
+	{
+		return ItemIndex;
+	}
+	//A new family has exactly one actor
+	return EnsureBlastFamily() ? BlastActorsBeginLive : INDEX_NONE;
+}
+
 void UBlastMeshComponent::UninitBlastFamily()
 {
+	if (DormantBodyInstance)
+	{
+		DormantBodyInstance->TermBody();
+		delete DormantBodyInstance;
+		DormantBodyInstance = nullptr;
+	}
+
 	if (!BlastFamily.IsValid())
 	{
 		return;
 	}
 
+	WaitForAsyncStressSolver(true);
+
 	for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
 	{
 		FActorData& ActorData = BlastActors[ActorIndex];
@@ -379,20 +556,48 @@ void UBlastMeshComponent::UninitBlastFamily()
 	{
 		StressSolver->release();
 		StressSolver = nullptr;
+
+		UWorld* World = GetWorld();
+		if (UBlastStressSolverSubsystem* StressSolverSubsystem = World ? World->GetSubsystem<UBlastStressSolverSubsystem>() : nullptr)
+		{
+			StressSolverSubsystem->UnregisterComponent(this);
+		}
 	}
 
-	if (DamageAccelerator)
+	DamageAccelerator.Reset();
+
+	// Damage that is still queued is dropped on purpose. It was aimed at the actors of this family, and applying it here would either
+	// run on physics state that's being destroyed (OnDestroyPhysicsState) or break the fresh family right after Reset. Call
+	// FlushQueuedDamage before resetting if it should still land
+	int32 DroppedDamageCount = CarriedOverDamage.Num();
+	FQueuedDamage Dropped;
+	while (QueuedDamage.Dequeue(Dropped))
+	{
+		DroppedDamageCount++;
+	}
+	CarriedOverDamage.Reset();
+	if (DroppedDamageCount > 0)
 	{
-		DamageAccelerator->release();
-		DamageAccelerator = nullptr;
+		UE_LOG(LogBlast, Verbose, TEXT("%s: dropped %d queued damage events on uninit."), *GetPathName(), DroppedDamageCount);
 	}
+	for (FBodyInstance* PooledBodyInstance : BodyInstancePool)
+	{
+		delete PooledBodyInstance;
+	}
+	BodyInstancePool.Empty();
+	BodySetupPool.Empty();
+	SplitNewActorsBuffer.Empty();
+	SplitScratch.Empty();
 
 	BlastActors.Reset();
+	BlastActorGenerations.Reset();
 	ActorBodySetups.Reset();
 	BlastFamily.Reset();
 
 	BlastActorsBeginLive = 0;
 	BlastActorsEndLive = 0;
+	AwakeActors.Empty();
+	bActorsWorldBoundsValid = false;
 
 	ShowRootChunks();
 }
@@ -495,7 +700,10 @@ void UBlastMeshComponent::TickComponent(float DeltaTime, enum ELevelTick TickTyp
 	{
 		if (World->IsGameWorld())
 		{
-			if (StressSolver)
+			ProcessQueuedDamage(QueuedDamageBudgetMs);
+
+			// Otherwise UBlastStressSolverSubsystem updates it within the world's budget
+			if (StressSolver && !bStressSolverScheduled)
 			{
 				TickStressSolver();
 			}
@@ -536,6 +744,10 @@ void UBlastMeshComponent::TickComponent(float DeltaTime, enum ELevelTick TickTyp
 	{
 		SyncComponentToRBPhysics();
 	}
+
+	// Everything RefreshBoneTransforms deferred this frame, including the pose tick from Super::TickComponent and damage processed above
+	FlushBoneRefreshSideEffects();
+	LastTickFrame = GFrameCounter;
 }
 
 void UBlastMeshComponent::PostEditImport()
@@ -554,6 +766,10 @@ UBodySetup* UBlastMeshComponent::GetBodySetup()
 	// (Original Comment): Returning null here prevents UPrimitiveComponent::OnCreatePhysicsState from creating a default state
 	if (GetSkinnedAsset())
 	{
+		if (DormantBodyInstance)
+		{
+			return DormantBodyInstance->GetBodySetup();
+		}
 		if (BlastMesh && ActorBodySetups.Num())
 		{
 			return ActorBodySetups[0];
@@ -574,6 +790,10 @@ FBodyInstance* UBlastMeshComponent::GetActorBodyInstance(int32 ActorIndex) const
 	{
 		ActorIndex = 0;
 	}
+	if (DormantBodyInstance)
+	{
+		return ActorIndex == 0 ? DormantBodyInstance : nullptr;
+	}
 	return (BlastActors.IsValidIndex(ActorIndex) && BlastActors[ActorIndex].BodyInstance)
 		       ? BlastActors[ActorIndex].BodyInstance
 		       : nullptr;
@@ -693,7 +913,7 @@ FBoxSphereBounds UBlastMeshComponent::GetChunkWorldBounds(int32 ChunkIndex) cons
 
 	const auto& CookedData = BlastMesh->GetCookedChunkData_AssumeUpToDate()[ChunkIndex];
 	//These AggGeom's are in componennt space, they are pre-transformed with chunk -> actor
-	return CookedData.CookedBodySetup->AggGeom.CalcAABB(GetActorWorldTransform(ActorIndex));
+	return CookedData.AggGeom.CalcAABB(GetActorWorldTransform(ActorIndex));
 }
 
 FVector UBlastMeshComponent::GetChunkWorldAngularVelocityInRadians(int32 ChunkIndex) const
@@ -818,19 +1038,36 @@ FBoxSphereBounds UBlastMeshComponent::CalcBounds(const FTransform& LocalToWorld)
 		}
 		else
 		{
-			FScopedSceneLock_Chaos Lock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
-			for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
+			if (!bActorsWorldBoundsValid)
 			{
-				UBodySetup* BodySetup = ActorBodySetups[ActorIndex];
-				const FActorData& BlastActor = BlastActors[ActorIndex];
-				if (BodySetup && BlastActor.BodyInstance)
+				// Only bodies that haven't been synced at their current transform need to be read from physics
+				TOptional<FScopedSceneLock_Chaos> Lock;
+				ActorsWorldBounds.Init();
+				for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
 				{
-					FTransform BodyWorldTransform = BlastActor.BodyInstance->GetUnrealWorldTransform_AssumesLocked();
-					BodyWorldTransform.SetScale3D(BlastActor.BodyInstance->Scale3D);
-					FBox AABB = BodySetup->AggGeom.CalcAABB(BodyWorldTransform);
-					NewBox += AABB;
+					const FActorData& BlastActor = BlastActors[ActorIndex];
+					if (!ActorBodySetups[ActorIndex] || !BlastActor.BodyInstance)
+					{
+						continue;
+					}
+					if (BlastActor.WorldBounds.IsValid)
+					{
+						ActorsWorldBounds += BlastActor.WorldBounds;
+					}
+					else
+					{
+						if (!Lock)
+						{
+							Lock = FScopedSceneLock_Chaos(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
+						}
+						FTransform BodyWorldTransform = BlastActor.BodyInstance->GetUnrealWorldTransform_AssumesLocked();
+						BodyWorldTransform.SetScale3D(BlastActor.BodyInstance->Scale3D);
+						ActorsWorldBounds += CalcActorWorldBounds(BlastActor, BodyWorldTransform);
+					}
 				}
+				bActorsWorldBoundsValid = true;
 			}
+			NewBox = ActorsWorldBounds;
 		}
 
 		FBoxSphereBounds NewBounds = NewBox;
@@ -839,6 +1076,11 @@ FBoxSphereBounds UBlastMeshComponent::CalcBounds(const FTransform& LocalToWorld)
 		CachedWorldToLocalTransform = LocalToWorld.ToInverseMatrixWithScale();
 		return NewBounds;
 	}
+	else if (DormantBodyInstance)
+	{
+		//The dormant body always sits at the component transform
+		return DormantBodyInstance->GetBodySetup()->AggGeom.CalcAABB(LocalToWorld);
+	}
 	else
 	{
 		return USkinnedMeshComponent::CalcBounds(LocalToWorld);
@@ -938,7 +1180,7 @@ void UBlastMeshComponent::OnCreatePhysicsState()
 
 	SetSkinnedAsset(BlastMesh->Mesh);
 
-	InitBlastFamily();
+	InitBlastFamilyOrDormantBody();
 }
 
 void UBlastMeshComponent::OnDestroyPhysicsState()
@@ -962,6 +1204,9 @@ bool UBlastMeshComponent::SyncChunksAndBodies()
 	bool bAnyBodiesChanged = false;
 
 	TBitArray<> BonesTouched(false, GetEditableComponentSpaceTransforms().Num());
+	MovedBoneChunks.Reset();
+	MovedBoneChunkBodies.Reset();
+	MovedBodyTransforms.Reset();
 
 	if (OwningSupportStructure && OwningSupportStructureIndex != INDEX_NONE)
 	{
@@ -972,7 +1217,24 @@ bool UBlastMeshComponent::SyncChunksAndBodies()
 	else
 	{
 		FScopedSceneLock_Chaos Lock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
-		for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
+
+		// Resting bodies can't have moved since they were last synced, so unless something moved all of them only the awake ones are looked at
+		const bool bSyncAll = bSyncAllActors || !CVarBlastSleepAwareBoneSync.GetValueOnGameThread();
+		bSyncAllActors = false;
+		TArray<int32, TInlineAllocator<64>> ActorsToSync;
+		if (bSyncAll)
+		{
+			for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
+			{
+				ActorsToSync.Add(ActorIndex);
+			}
+		}
+		else
+		{
+			ActorsToSync.Append(AwakeActors);
+		}
+
+		for (int32 ActorIndex : ActorsToSync)
 		{
 			FActorData& ActorData = BlastActors[ActorIndex];
 			FBodyInstance* BodyInst = ActorData.BodyInstance;
@@ -981,6 +1243,12 @@ bool UBlastMeshComponent::SyncChunksAndBodies()
 				continue;
 			}
 
+			// Kinematic bodies only move with the component, which sets bSyncAllActors, and sleeping ones stay where they were synced last
+			if (ActorData.AwakeActorsIndex != INDEX_NONE && (ActorData.bSleepPending || !BodyInst->IsInstanceSimulatingPhysics()))
+			{
+				RemoveAwakeActor(ActorIndex);
+			}
+
 			FTransform BodyWT = BodyInst->GetUnrealWorldTransform_AssumesLocked();
 			BodyWT.SetScale3D(BodyInst->Scale3D);
 
@@ -990,21 +1258,37 @@ bool UBlastMeshComponent::SyncChunksAndBodies()
 			{
 				bAnyBodiesChanged = true;
 				ActorData.PreviousBodyWorldTransform = BodyWT;
-				FTransform BodyCST = BodyWT.GetRelativeTransform(GetComponentTransform());
+				MergeActorWorldBounds(ActorData, BodyWT);
+				const int32 BodyTransformIndex = MovedBodyTransforms.Add(BodyWT.GetRelativeTransform(GetComponentTransform()));
 
+				// The bones are written below, once all bodies have been read
 				for (const FActorChunkData& ChunkData : ActorData.Chunks)
 				{
 					// The indices in ActorChunkIndices are NEW blast indices, so must go through indirection.
 					uint32 ChunkIndex = ChunkData.ChunkIndex;
 					int32 BoneIndex = BlastMesh->ChunkIndexToBoneIndex[ChunkIndex];
-					GetEditableComponentSpaceTransforms()[BoneIndex] = BlastMesh->
-						GetComponentSpaceInitialBoneTransform(BoneIndex) * BodyCST;
 					BonesTouched[BoneIndex] = true;
+					MovedBoneChunks.Add(ChunkIndex);
+					MovedBoneChunkBodies.Add(BodyTransformIndex);
 				}
 			}
 		}
 	}
 
+	if (MovedBoneChunkBodies.Num() > 0)
+	{
+		// Every chunk belongs to one actor and has its own bone, so each bone is written by exactly one iteration
+		const uint32* ChunkIndexToBoneIndex = BlastMesh->ChunkIndexToBoneIndex.GetData();
+		FTransform* SpaceBasesData = GetEditableComponentSpaceTransforms().GetData();
+		const int32 MovedChunkCount = MovedBoneChunkBodies.Num();
+		const bool bParallel = MovedChunkCount > CVarBlastParallelBoneSyncMinChunks.GetValueOnGameThread();
+		ParallelFor(MovedChunkCount, [this, ChunkIndexToBoneIndex, SpaceBasesData](int32 MovedIndex)
+		{
+			const int32 BoneIndex = ChunkIndexToBoneIndex[MovedBoneChunks[MovedIndex]];
+			SpaceBasesData[BoneIndex] = BlastMesh->GetComponentSpaceInitialBoneTransform(BoneIndex) * MovedBodyTransforms[MovedBoneChunkBodies[MovedIndex]];
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
 	//We need to move the bones under any of the body bones that moved, technically we don't need to update these until SetupNewBlastActor since they are invisible, but just for sanity I think we should
 	//until it's proven to be a perf bottleneck since SkinnedMeshComponent::GetBone* are not virtual so we can't do them on demand when somebody queries them. This means GetBoneTransform would give wrong values for them.
 	if (bAnyBodiesChanged)
@@ -1018,23 +1302,57 @@ bool UBlastMeshComponent::SyncChunksAndBodies()
 		const FTransform* LocalTransformsData = BoneSpaceTransforms.GetData();
 		FTransform* SpaceBasesData = GetEditableComponentSpaceTransforms().GetData();
 
-		//Skip 0 since we know the root bone is fine
-		for (int32 BoneIndex = 1; BoneIndex < BoneSpaceTransforms.Num(); BoneIndex++)
+		// Blast meshes have a root bone plus one bone per chunk, parented like the chunks. Then only the subtrees under the chunks that moved need
+		// updating, which we can walk with the chunk hierarchy instead of going over the whole skeleton
+		const UBlastAsset* BlastAsset = GetBlastAsset();
+		const uint32 ChunkCount = BlastAsset ? BlastAsset->GetChunkCount() : 0;
+		if (MovedBoneChunks.Num() > 0 && ChunkCount + 1 == uint32(BoneSpaceTransforms.Num()) && uint32(BlastMesh->ChunkIndexToBoneIndex.Num()) == ChunkCount)
 		{
-			//Did we just update this
-			if (!BonesTouched[BoneIndex])
-			{
-				// For all bones below the root, final component-space transform is relative transform * component-space transform of parent.
-				const int32 ParentIndex = GetSkinnedAsset()->GetRefSkeleton().GetParentIndex(BoneIndex);
+			const NvBlastChunk* ChunkData = NvBlastAssetGetChunks(BlastAsset->GetLoadedAsset(), Nv::Blast::logLL);
+			const uint32* ChunkIndexToBoneIndex = BlastMesh->ChunkIndexToBoneIndex.GetData();
 
-				if (BonesTouched[ParentIndex])
+			// The list grows while we go over it, so parents are always done before their children
+			for (int32 MovedIndex = 0; MovedIndex < MovedBoneChunks.Num(); MovedIndex++)
+			{
+				const NvBlastChunk& Chunk = ChunkData[MovedBoneChunks[MovedIndex]];
+				const int32 ParentIndex = ChunkIndexToBoneIndex[MovedBoneChunks[MovedIndex]];
+				for (uint32 ChildChunkIndex = Chunk.firstChildIndex; ChildChunkIndex < Chunk.childIndexStop; ChildChunkIndex++)
 				{
-					FTransform::Multiply(SpaceBasesData + BoneIndex, LocalTransformsData + BoneIndex,
-					                     SpaceBasesData + ParentIndex);
-					BonesTouched[BoneIndex] = true;
+					const int32 BoneIndex = ChunkIndexToBoneIndex[ChildChunkIndex];
+					if (!BonesTouched[BoneIndex])
+					{
+						FTransform::Multiply(SpaceBasesData + BoneIndex, LocalTransformsData + BoneIndex,
+						                     SpaceBasesData + ParentIndex);
+						BonesTouched[BoneIndex] = true;
+						MovedBoneChunks.Add(ChildChunkIndex);
+
+						checkSlow(GetSkinnedAsset()->GetRefSkeleton().GetParentIndex(BoneIndex) == ParentIndex);
+						checkSlow(GetEditableComponentSpaceTransforms()[BoneIndex].IsRotationNormalized());
+						checkSlow(!GetEditableComponentSpaceTransforms()[BoneIndex].ContainsNaN());
+					}
+				}
+			}
+		}
+		else
+		{
+			//Skip 0 since we know the root bone is fine
+			for (int32 BoneIndex = 1; BoneIndex < BoneSpaceTransforms.Num(); BoneIndex++)
+			{
+				//Did we just update this
+				if (!BonesTouched[BoneIndex])
+				{
+					// For all bones below the root, final component-space transform is relative transform * component-space transform of parent.
+					const int32 ParentIndex = GetSkinnedAsset()->GetRefSkeleton().GetParentIndex(BoneIndex);
 
-					checkSlow(GetEditableComponentSpaceTransforms()[BoneIndex].IsRotationNormalized());
-					checkSlow(!GetEditableComponentSpaceTransforms()[BoneIndex].ContainsNaN());
+					if (BonesTouched[ParentIndex])
+					{
+						FTransform::Multiply(SpaceBasesData + BoneIndex, LocalTransformsData + BoneIndex,
+						                     SpaceBasesData + ParentIndex);
+						BonesTouched[BoneIndex] = true;
+
+						checkSlow(GetEditableComponentSpaceTransforms()[BoneIndex].IsRotationNormalized());
+						checkSlow(!GetEditableComponentSpaceTransforms()[BoneIndex].ContainsNaN());
+					}
 				}
 			}
 		}
@@ -1056,29 +1374,58 @@ void UBlastMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction* Tic
 
 	if (bBodiesMoved || !bHasValidBoneTransform || bChunkVisibilityChanged || bAddedOrRemovedActorSinceLastRefresh)
 	{
-		// Flip bone buffer and send 'post anim' notification
+		// Flip bone buffer and send 'post anim' notification. Done right away so the bone getters are correct
 		FinalizeBoneTransform();
 
-		// Update Child Transform - The above function changes bone transform, so will need to update child transform
-		UpdateChildTransforms();
+		bAddedOrRemovedActorSinceLastRefresh = false;
+		bBoneRefreshSideEffectsPending = true;
+	}
+
+	// Damage, setup and the pose tick can all get here in the same frame, the rest only needs doing once after the last of them
+	if (!WillTickLaterThisFrame())
+	{
+		FlushBoneRefreshSideEffects();
+	}
+}
+
+void UBlastMeshComponent::FlushBoneRefreshSideEffects()
+{
+	if (!bBoneRefreshSideEffectsPending)
+	{
+		return;
+	}
+	bBoneRefreshSideEffectsPending = false;
+
+	// Update Child Transform - The bone transforms changed, so will need to update child transform
+	UpdateChildTransforms();
 
-		// animation often change overlap. 
+	// animation often change overlap. Nothing to update if we don't generate overlap events though
+	if (GetGenerateOverlapEvents())
+	{
 		UpdateOverlaps();
+	}
 
-		// Cached local bounds are now out of date
-		InvalidateCachedBounds();
+	// Cached local bounds are now out of date
+	InvalidateCachedBounds();
 
-		// update bounds
-		UpdateBounds();
+	// update bounds
+	UpdateBounds();
 
-		// Need to send new bounds to 
-		MarkRenderTransformDirty();
+	// Need to send new bounds to 
+	MarkRenderTransformDirty();
 
-		// New bone positions need to be sent to render thread
-		MarkRenderDynamicDataDirty();
+	// New bone positions need to be sent to render thread
+	MarkRenderDynamicDataDirty();
+}
 
-		bAddedOrRemovedActorSinceLastRefresh = false;
+bool UBlastMeshComponent::WillTickLaterThisFrame() const
+{
+	const UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld() || (World->IsPaused() && !PrimaryComponentTick.bTickEvenWhenPaused))
+	{
+		return false;
 	}
+	return PrimaryComponentTick.IsTickFunctionRegistered() && IsComponentTickEnabled() && PrimaryComponentTick.TickInterval <= 0.f && LastTickFrame != GFrameCounter;
 }
 
 class FBlastMeshComponentInstanceData : public FPrimitiveComponentInstanceData
@@ -1297,7 +1644,7 @@ bool UBlastMeshComponent::ShouldCreatePhysicsState() const
 
 bool UBlastMeshComponent::HasValidPhysicsState() const
 {
-	return BlastFamily.IsValid();
+	return BlastFamily.IsValid() || DormantBodyInstance != nullptr;
 }
 
 void UBlastMeshComponent::OnRegister()
@@ -1395,6 +1742,17 @@ void UBlastMeshComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 		return;
 	}
 
+	// The bones are relative to the component, so even resting bodies need to be synced again
+	bSyncAllActors = true;
+
+	if (DormantBodyInstance)
+	{
+		FScopedSceneLock_Chaos Lock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Write);
+		DormantBodyInstance->SetBodyTransform(GetComponentTransform(), Teleport);
+		DormantBodyInstance->UpdateBodyScale(GetComponentTransform().GetScale3D());
+		return;
+	}
+
 	TOptional<FScopedSceneLock_Chaos> Lock;
 	for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
 	{
@@ -1409,12 +1767,19 @@ void UBlastMeshComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 			//Actor transform pivots are all at component origin
 			Actor.BodyInstance->SetBodyTransform(GetComponentTransform(), Teleport);
 			Actor.BodyInstance->UpdateBodyScale(GetComponentTransform().GetScale3D());
+			// The bounds are computed before the next sync, so read them from the body then
+			Actor.WorldBounds.Init();
+			bActorsWorldBoundsValid = false;
 		}
 	}
 }
 
 void UBlastMeshComponent::ForEachBody(TFunctionRef<void(FBodyInstance*)> Worker)
 {
+	if (DormantBodyInstance)
+	{
+		Worker(DormantBodyInstance);
+	}
 	for (int32 Idx = BlastActorsBeginLive; Idx < BlastActorsEndLive; Idx++)
 	{
 		if (BlastActors[Idx].BodyInstance)
@@ -1426,6 +1791,10 @@ void UBlastMeshComponent::ForEachBody(TFunctionRef<void(FBodyInstance*)> Worker)
 
 void UBlastMeshComponent::ForEachBody(TFunctionRef<void(const FBodyInstance*)> Worker) const
 {
+	if (DormantBodyInstance)
+	{
+		Worker(DormantBodyInstance);
+	}
 	for (int32 Idx = BlastActorsBeginLive; Idx < BlastActorsEndLive; Idx++)
 	{
 		if (BlastActors[Idx].BodyInstance)
@@ -1438,6 +1807,10 @@ void UBlastMeshComponent::ForEachBody(TFunctionRef<void(const FBodyInstance*)> W
 void UBlastMeshComponent::ForEachBodyEx(TFunctionRef<void(FBodyInstance*, bool&)> Worker)
 {
 	bool bDone = false;
+	if (DormantBodyInstance)
+	{
+		Worker(DormantBodyInstance, bDone);
+	}
 	for (int32 Idx = BlastActorsBeginLive; Idx < BlastActorsEndLive; Idx++)
 	{
 		if (BlastActors[Idx].BodyInstance)
@@ -1454,6 +1827,10 @@ void UBlastMeshComponent::ForEachBodyEx(TFunctionRef<void(FBodyInstance*, bool&)
 void UBlastMeshComponent::ForEachBodyEx(TFunctionRef<void(const FBodyInstance*, bool&)> Worker) const
 {
 	bool bDone = false;
+	if (DormantBodyInstance)
+	{
+		Worker(DormantBodyInstance, bDone);
+	}
 	for (int32 Idx = BlastActorsBeginLive; Idx < BlastActorsEndLive; Idx++)
 	{
 		if (BlastActors[Idx].BodyInstance)
@@ -1784,7 +2161,7 @@ bool UBlastMeshComponent::HasBeenFractured() const
 void UBlastMeshComponent::Reset()
 {
 	UninitBlastFamily();
-	InitBlastFamily();
+	InitBlastFamilyOrDormantBody();
 }
 
 void UBlastMeshComponent::BroadcastOnDamaged(FName ActorName, const FVector& DamageOrigin, const FRotator& DamageRot,
@@ -1874,6 +2251,11 @@ EBlastDamageResult UBlastMeshComponent::ApplyDamageProgram(const FBlastBaseDamag
 			DamageProgram, Origin, Rot, BoneName);
 	}
 
+	if (!EnsureBlastFamily())
+	{
+		return EBlastDamageResult::None;
+	}
+
 	EBlastDamageResult totalResult = EBlastDamageResult::None;
 	if (BoneName.IsNone())
 	{
@@ -1899,6 +2281,139 @@ EBlastDamageResult UBlastMeshComponent::ApplyDamageProgram(const FBlastBaseDamag
 	return totalResult;
 }
 
+EBlastDamageResult UBlastMeshComponent::ApplyDamageProgramBatch(const FBlastBaseDamageProgram& DamageProgram,
+                                                                TArrayView<const FVector> Origins, FQuat Rot)
+{
+	if (bIgnoreDamage || Origins.Num() == 0)
+	{
+		return EBlastDamageResult::None;
+	}
+
+	if (OwningSupportStructure && OwningSupportStructureIndex != INDEX_NONE)
+	{
+		return OwningSupportStructure->GetExtendedSupportMeshComponent()->ApplyDamageProgramBatch(
+			DamageProgram, Origins, Rot);
+	}
+
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(BodyInstance.GetObjectType());
+	ObjectParams.AddObjectTypesToQuery(SmallChunkBodyInstance.GetObjectType()); // Also check for small chunks
+	static FName BlastDamageOverlapName(TEXT("BlastDamageOverlap"));
+	FCollisionQueryParams Params(BlastDamageOverlapName, false);
+	const FCollisionShape CollisionShape = DamageProgram.GetCollisionShape();
+
+	// Group the hits by the actor they overlap so each actor is only split once
+	TMap<uint32, TArray<FVector, TInlineAllocator<8>>> OriginsPerActor;
+	TArray<FOverlapResult> Overlaps;
+	for (const FVector& Origin : Origins)
+	{
+		Overlaps.Reset();
+		GetWorld()->OverlapMultiByObjectType(Overlaps, Origin, Rot, ObjectParams, CollisionShape, Params);
+		for (const FOverlapResult& OverlapResult : Overlaps)
+		{
+			if (OverlapResult.Component.Get() == this)
+			{
+				const int32 ActorIndex = WakeForDamage(OverlapResult.ItemIndex);
+				if (ActorIndex != INDEX_NONE)
+				{
+					OriginsPerActor.FindOrAdd(ActorIndex).Add(Origin);
+				}
+			}
+		}
+	}
+
+	EBlastDamageResult totalResult = EBlastDamageResult::None;
+	for (const auto& ActorOrigins : OriginsPerActor)
+	{
+		EBlastDamageResult result = ApplyDamageOnActor(ActorOrigins.Key, DamageProgram, ActorOrigins.Value, Rot);
+		if (result > totalResult)
+		{
+			totalResult = result;
+		}
+	}
+
+	return totalResult;
+}
+
+EBlastDamageResult UBlastMeshComponent::ApplyRadialDamageBatch(const TArray<FVector>& Origins, float MinRadius,
+                                                               float MaxRadius, float Damage, float ImpulseStrength,
+                                                               bool bImpulseVelChange)
+{
+	BlastRadialDamageProgram program(Damage, MinRadius, MaxRadius, ImpulseStrength, bImpulseVelChange);
+	return ApplyDamageProgramBatch(program, Origins);
+}
+
+EBlastDamageResult UBlastMeshComponent::ApplyShearDamageBatch(const TArray<FVector>& Origins, FQuat Direction,
+                                                              float MinRadius, float MaxRadius, float Damage,
+                                                              float ImpulseStrength, bool bImpulseVelChange)
+{
+	BlastShearDamageProgram program(Damage, MinRadius, MaxRadius, ImpulseStrength, bImpulseVelChange);
+	return ApplyDamageProgramBatch(program, Origins, Direction);
+}
+
+void UBlastMeshComponent::QueueDamageProgram(TSharedRef<const FBlastBaseDamageProgram, ESPMode::ThreadSafe> DamageProgram,
+                                             FVector Origin, FQuat Rot)
+{
+	QueuedDamage.Enqueue(FQueuedDamage{DamageProgram, Origin, Rot});
+}
+
+void UBlastMeshComponent::QueueRadialDamage(FVector Origin, float MinRadius, float MaxRadius, float Damage,
+                                            float ImpulseStrength, bool bImpulseVelChange, bool bRandomizeImpulse)
+{
+	QueueDamageProgram(MakeShared<BlastRadialDamageProgram, ESPMode::ThreadSafe>(Damage, MinRadius, MaxRadius, ImpulseStrength, bImpulseVelChange, bRandomizeImpulse), Origin);
+}
+
+void UBlastMeshComponent::FlushQueuedDamage()
+{
+	ProcessQueuedDamage(0.f);
+}
+
+void UBlastMeshComponent::ProcessQueuedDamage(float BudgetMs)
+{
+	FQueuedDamage Damage;
+	while (QueuedDamage.Dequeue(Damage))
+	{
+		CarriedOverDamage.Add(MoveTemp(Damage));
+	}
+
+	if (CarriedOverDamage.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_BlastMeshComponent_ProcessQueuedDamage);
+
+	// Keeps a single batch short enough that checking the budget between batches is good enough
+	const int32 MaxOriginsPerBatch = 64;
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+	TArray<FVector> Origins;
+	while (CarriedOverDamage.Num() > 0)
+	{
+		// Merge damage queued with the same rotation and a program doing the same damage, even if every hit made its own program.
+		// ApplyDamageProgramBatch then groups the origins by the actor they hit and only splits each actor once
+		const TSharedPtr<const FBlastBaseDamageProgram, ESPMode::ThreadSafe> DamageProgram = CarriedOverDamage[0].DamageProgram;
+		const FQuat Rot = CarriedOverDamage[0].Rot;
+		Origins.Reset();
+		CarriedOverDamage.RemoveAll([&](const FQueuedDamage& Queued)
+		{
+			if (Origins.Num() < MaxOriginsPerBatch && Queued.Rot.Equals(Rot) && DamageProgram->IsSameDamageAs(*Queued.DamageProgram))
+			{
+				Origins.Add(Queued.Origin);
+				return true;
+			}
+			return false;
+		});
+
+		ApplyDamageProgramBatch(*DamageProgram, Origins, Rot);
+
+		if (BudgetMs > 0.f && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+}
+
 EBlastDamageResult UBlastMeshComponent::ApplyRadialDamage(FVector Origin, float MinRadius, float MaxRadius,
                                                           float Damage, float ImpulseStrength, bool bImpulseVelChange,
                                                           bool bRandomizeImpulse)
@@ -1967,30 +2482,102 @@ EBlastDamageResult UBlastMeshComponent::ApplyDamageProgramOverlapFiltered(
 	FCollisionQueryParams Params(BlastDamageOverlapName, false);
 	GWorld->OverlapMultiByObjectType(Overlaps, Origin, Rot, ObjectParams, DamageProgram.GetCollisionShape(), Params);
 	EBlastDamageResult totalResult = EBlastDamageResult::None;
+	TArray<FBlastPendingFracture> PendingFractures;
+	PendingFractures.Reserve(Overlaps.Num());
 	for (FOverlapResult& OverlapResult : Overlaps)
 	{
 		if (mesh == nullptr || OverlapResult.Component.Get() == mesh)
 		{
 			UBlastMeshComponent* owner = Cast<UBlastMeshComponent>(OverlapResult.Component.Get());
-			if (owner != nullptr && !owner->bIgnoreDamage)
+			const int32 ActorIndex = owner != nullptr && !owner->bIgnoreDamage ? owner->WakeForDamage(OverlapResult.ItemIndex) : INDEX_NONE;
+			if (ActorIndex != INDEX_NONE)
 			{
-				uint32 actorIndex = OverlapResult.ItemIndex;
-				EBlastDamageResult result = owner->ApplyDamageOnActor(actorIndex, DamageProgram, Origin, Rot);
-				if (result > totalResult)
-				{
-					totalResult = result;
-				}
+				FBlastPendingFracture& Pending = PendingFractures.AddDefaulted_GetRef();
+				Pending.Component = owner;
+				Pending.ActorIndex = ActorIndex;
 			}
 		}
 	}
 
-	return totalResult;
-}
-
-EBlastDamageResult UBlastMeshComponent::ApplyDamageOnActor(uint32 actorIndex,
-                                                           const FBlastBaseDamageProgram& DamageProgram,
-                                                           const FVector& Origin, const FQuat& Rot,
-                                                           FScopedSceneLock_Chaos* SceneLock)
+	// Generating fracture commands only reads the actor, so when many actors are hit do it for all of them on the task graph first
+	// and then apply the fractures and split serially. Actors which can't fracture are left for ApplyDamageOnActor to crumble.
+	const bool bGenerateInParallel = PendingFractures.Num() > 1 && DamageProgram.CanGenerateFractureInParallel();
+	if (bGenerateInParallel)
+	{
+		for (FBlastPendingFracture& Pending : PendingFractures)
+		{
+			UBlastMeshComponent* owner = Pending.Component;
+			if (!owner->BlastActors.IsValidIndex(Pending.ActorIndex))
+			{
+				continue;
+			}
+			NvBlastActor* Actor = owner->BlastActors[Pending.ActorIndex].BlastActor;
+			FBodyInstance* BodyInst = owner->BlastActors[Pending.ActorIndex].BodyInstance;
+			if (Actor && BodyInst && NvBlastActorCanFracture(Actor, Nv::Blast::logLL))
+			{
+				FTransform WT = BodyInst->GetUnrealWorldTransform();
+				WT.SetScale3D(BodyInst->Scale3D);
+				owner->MakeDamageProgramInput(WT, Origin, Rot, Pending.Input);
+				Pending.ActorGeneration = owner->BlastActorGenerations[Pending.ActorIndex];
+				Pending.BlastActor = Actor;
+				Pending.BodyInstance = BodyInst;
+			}
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_BlastMeshComponent_GenerateOverlapFracture);
+		ParallelFor(PendingFractures.Num(), [&PendingFractures, &DamageProgram](int32 Index)
+		{
+			FBlastPendingFracture& Pending = PendingFractures[Index];
+			if (Pending.BlastActor)
+			{
+				TGuardValue<FBlastPendingFracture*> CaptureGuard(GBlastFractureCapture, &Pending);
+				DamageProgram.Execute(Pending.ActorIndex, Pending.BodyInstance, Pending.Input, *Pending.Component);
+			}
+		});
+	}
+
+	for (FBlastPendingFracture& Pending : PendingFractures)
+	{
+		EBlastDamageResult result = Pending.Component->ApplyDamageOnActor(Pending.ActorIndex, DamageProgram, Origin, Rot, nullptr,
+		                                                                   Pending.BlastActor ? &Pending : nullptr);
+		if (result > totalResult)
+		{
+			totalResult = result;
+		}
+	}
+
+	return totalResult;
+}
+
+void UBlastMeshComponent::MakeDamageProgramInput(const FTransform& BodyWorldTransform, const FVector& Origin, const FQuat& Rot,
+                                                 FBlastBaseDamageProgram::FInput& OutInput) const
+{
+	//This is kind of confusing but it seems like Blast operates 100% in component space and not in actor space, but the original component space since it doesn't track transform changes
+	const FTransform invWT = BodyWorldTransform.Inverse();
+
+	FQuat WorldRotation = Rot; // without this line (quat * quat) crashes for some reason
+
+	OutInput.worldOrigin = FVector3f(Origin);
+	OutInput.worldRot = FQuat4f(WorldRotation);
+	OutInput.localOrigin = FVector3f(invWT.TransformPosition(Origin));
+	OutInput.localRot = FQuat4f(invWT.GetRotation() * WorldRotation);
+	OutInput.material = &GetUsedBlastMaterial();
+}
+
+EBlastDamageResult UBlastMeshComponent::ApplyDamageOnActor(uint32 actorIndex,
+                                                           const FBlastBaseDamageProgram& DamageProgram,
+                                                           const FVector& Origin, const FQuat& Rot,
+                                                           FScopedSceneLock_Chaos* SceneLock,
+                                                           FBlastPendingFracture* Pending)
+{
+	return ApplyDamageOnActor(actorIndex, DamageProgram, MakeArrayView(&Origin, 1), Rot, SceneLock, Pending);
+}
+
+EBlastDamageResult UBlastMeshComponent::ApplyDamageOnActor(uint32 actorIndex,
+                                                           const FBlastBaseDamageProgram& DamageProgram,
+                                                           TArrayView<const FVector> Origins, const FQuat& Rot,
+                                                           FScopedSceneLock_Chaos* SceneLock,
+                                                           FBlastPendingFracture* Pending)
 {
 	//Should never happen for a sub-component
 	check(!OwningSupportStructure || OwningSupportStructureIndex == INDEX_NONE);
@@ -2042,31 +2629,53 @@ EBlastDamageResult UBlastMeshComponent::ApplyDamageOnActor(uint32 actorIndex,
 	FBodyInstance* BodyInst = ActorData.BodyInstance;
 	check(BodyInst);
 
-	//This is kind of confusing but it seems like Blast operates 100% in component space and not in actor space, but the original component space since it doesn't track transform changes
 	FTransform WT = SceneLock ? BodyInst->GetUnrealWorldTransform_AssumesLocked() : BodyInst->GetUnrealWorldTransform();
 	WT.SetScale3D(BodyInst->Scale3D);
-	const FTransform invWT = WT.Inverse();
-
-	FQuat WorldRotation = Rot; // without this line (quat * quat) crashes for some reason
 
-	FBlastBaseDamageProgram::FInput ProgramInput;
-	ProgramInput.worldOrigin = FVector3f(Origin);
-	ProgramInput.worldRot = FQuat4f(WorldRotation);
-	ProgramInput.localOrigin = FVector3f(invWT.TransformPosition(Origin));
-	ProgramInput.localRot = FQuat4f(invWT.GetRotation() * WorldRotation);
-	ProgramInput.material = &GetUsedBlastMaterial();
+	TArray<FBlastBaseDamageProgram::FInput, TInlineAllocator<1>> ProgramInputs;
+	ProgramInputs.SetNumUninitialized(Origins.Num());
+	for (int32 OriginIndex = 0; OriginIndex < Origins.Num(); OriginIndex++)
+	{
+		MakeDamageProgramInput(WT, Origins[OriginIndex], Rot, ProgramInputs[OriginIndex]);
+	}
 
 	if (StressSolver)
 	{
-		DamageProgram.ExecuteStress(*StressSolver, actorIndex, BodyInst, ProgramInput, *this);
+		WaitForAsyncStressSolver(false);
+		for (const FBlastBaseDamageProgram::FInput& ProgramInput : ProgramInputs)
+		{
+			DamageProgram.ExecuteStress(*StressSolver, actorIndex, BodyInst, ProgramInput, *this);
+		}
+		bStressSolverInputChanged = true;
 	}
 
 	RecentDamageEventsBuffer.Reset();
 
-	if (DamageProgram.Execute(actorIndex, BodyInst, ProgramInput, *this))
+	// Pre-generated commands are only valid if they were generated for this exact actor. Damage to an earlier hit actor can split this one
+	// in between and the slot and pointer can be reused, so check the generation too. Otherwise the commands are generated again here
+	const bool bPendingStillValid = Pending && Pending->BlastActor == Actor && IsBlastActorLive(actorIndex, Pending->ActorGeneration);
+	TGuardValue<FBlastPendingFracture*> PendingGuard(PendingFracture, bPendingStillValid ? Pending : nullptr);
+
+	// Apply the fracture from every hit first so the actor only has to be split once
+	int32 FirstDamagingInput = INDEX_NONE;
+	for (int32 OriginIndex = 0; OriginIndex < Origins.Num(); OriginIndex++)
 	{
-		DamageProgram.ExecutePostDamage(actorIndex, BodyInst, ProgramInput, *this);
-		BroadcastOnDamaged(ActorIndexToActorName(actorIndex), Origin, Rot.Rotator(), DamageProgram.DamageType);
+		const FBlastBaseDamageProgram::FInput& ProgramInput = ProgramInputs[OriginIndex];
+		if (DamageProgram.Execute(actorIndex, BodyInst, ProgramInput, *this))
+		{
+			DamageProgram.ExecutePostDamage(actorIndex, BodyInst, ProgramInput, *this);
+			BroadcastOnDamaged(ActorIndexToActorName(actorIndex), Origins[OriginIndex], Rot.Rotator(), DamageProgram.DamageType);
+			if (FirstDamagingInput == INDEX_NONE)
+			{
+				FirstDamagingInput = OriginIndex;
+			}
+		}
+	}
+
+	if (FirstDamagingInput != INDEX_NONE)
+	{
+		// New actors get their post actor created callbacks (impulses) from the first hit that did damage
+		const FBlastBaseDamageProgram::FInput& ProgramInput = ProgramInputs[FirstDamagingInput];
 		if (HandlePostDamage(Actor, DamageProgram.DamageType, &DamageProgram, &ProgramInput, SceneLock))
 		{
 			// If the damage program wants to do anything else after the split, let it do so here (physics impulse)
@@ -2090,10 +2699,37 @@ bool UBlastMeshComponent::ExecuteBlastDamageProgram(uint32 actorIndex, const NvB
 	check(Actor != nullptr);
 
 	NvBlastFractureBuffers fractureBuffers;
-	FBlastFractureScratch::getInstance().getFractureBuffers(fractureBuffers);
 
-	// Take the program and params above and generate fracture commands into FractureBuffers
-	NvBlastActorGenerateFracture(&fractureBuffers, Actor, program, &programParams, Nv::Blast::logLL, nullptr);
+	if (PendingFracture && PendingFracture->ActorIndex == actorIndex && PendingFracture->bGenerated)
+	{
+		// Commands were already generated on a worker thread, just apply them
+		fractureBuffers.bondFractureCount = PendingFracture->BondFractures.Num();
+		fractureBuffers.bondFractures = PendingFracture->BondFractures.GetData();
+		fractureBuffers.chunkFractureCount = PendingFracture->ChunkFractures.Num();
+		fractureBuffers.chunkFractures = PendingFracture->ChunkFractures.GetData();
+		PendingFracture->bGenerated = false;
+	}
+	else
+	{
+		UBlastAsset* BlastAsset = GetBlastAsset();
+		check(BlastAsset != nullptr);
+
+		// Scratch is per-thread, so this is safe to call for independent components from worker threads
+		FBlastFractureScratch::getInstance().getFractureBuffers(fractureBuffers, BlastAsset->GetChunkCount(), BlastAsset->GetBondCount());
+
+		// Take the program and params above and generate fracture commands into FractureBuffers
+		NvBlastActorGenerateFracture(&fractureBuffers, Actor, program, &programParams, Nv::Blast::logLL, nullptr);
+	}
+
+	if (FBlastPendingFracture* Capture = GBlastFractureCapture)
+	{
+		// Only generating on a worker thread, keep a copy of the commands since the scratch belongs to this thread
+		check(Capture->Component == this && Capture->ActorIndex == actorIndex);
+		Capture->BondFractures.Append(fractureBuffers.bondFractures, fractureBuffers.bondFractureCount);
+		Capture->ChunkFractures.Append(fractureBuffers.chunkFractures, fractureBuffers.chunkFractureCount);
+		Capture->bGenerated = true;
+		return fractureBuffers.bondFractureCount > 0 || fractureBuffers.chunkFractureCount > 0;
+	}
 
 	// Apply generated fracture commands
 	if (fractureBuffers.bondFractureCount > 0 || fractureBuffers.chunkFractureCount > 0)
@@ -2114,6 +2750,8 @@ void UBlastMeshComponent::ApplyFracture(uint32 actorIndex, const NvBlastFracture
 	NvBlastActor* Actor = ActorData.BlastActor;
 	bHasBeenFractured = true;
 	SetCanEverAffectNavigation(false);
+	// Bond healths are read by the stress solver, and commands it generated before this damage may not fit the actor anymore or even name its successor
+	WaitForAsyncStressSolver(true);
 	// Apply the generated fracture commands to the actor that was hit.
 	NvBlastActorApplyFracture(nullptr, Actor, &fractureBuffers, Nv::Blast::logLL, nullptr);
 
@@ -2123,8 +2761,11 @@ void UBlastMeshComponent::ApplyFracture(uint32 actorIndex, const NvBlastFracture
 
 	if (bFireBondEvents || bFireChunkEvents)
 	{
-		// Reset buffer
-		RecentDamageEventsBuffer.Reset();
+		// Events from several fractures of the same actor are accumulated until it's split
+		if (RecentDamageEventsBuffer.ActorIndex != actorIndex)
+		{
+			RecentDamageEventsBuffer.Reset();
+		}
 		RecentDamageEventsBuffer.ActorIndex = actorIndex;
 		RecentDamageEventsBuffer.DamageType = DamageType;
 
@@ -2141,7 +2782,7 @@ void UBlastMeshComponent::ApplyFracture(uint32 actorIndex, const NvBlastFracture
 		// Bond damage events
 		if (bFireBondEvents)
 		{
-			RecentDamageEventsBuffer.BondEvents.Empty(fractureBuffers.bondFractureCount);
+			RecentDamageEventsBuffer.BondEvents.Reserve(RecentDamageEventsBuffer.BondEvents.Num() + fractureBuffers.bondFractureCount);
 			for (uint32 i = 0; i < fractureBuffers.bondFractureCount; i++)
 			{
 				const NvBlastBondFractureData& FractureData = fractureBuffers.bondFractures[i];
@@ -2175,7 +2816,7 @@ void UBlastMeshComponent::ApplyFracture(uint32 actorIndex, const NvBlastFracture
 		// Chunk damage events
 		if (bFireChunkEvents)
 		{
-			RecentDamageEventsBuffer.ChunkEvents.Empty(fractureBuffers.chunkFractureCount);
+			RecentDamageEventsBuffer.ChunkEvents.Reserve(RecentDamageEventsBuffer.ChunkEvents.Num() + fractureBuffers.chunkFractureCount);
 			for (uint32 i = 0; i < fractureBuffers.chunkFractureCount; i++)
 			{
 				const NvBlastChunkFractureData& FractureData = fractureBuffers.chunkFractures[i];
@@ -2199,21 +2840,32 @@ bool UBlastMeshComponent::HandlePostDamage(NvBlastActor* actor, FName DamageType
 {
 	// At this point we can split off some new actors
 
-	uint32 chunkCount = GetBlastAsset()->GetChunkCount();
-
-	TArray<NvBlastActor*> newActorsBuffer;
-	newActorsBuffer.SetNum(chunkCount);
-
-	TArray<uint8> splitScratch;
-	splitScratch.SetNum(NvBlastActorGetRequiredScratchForSplit(actor, Nv::Blast::logLL) + 0x10); // add 16 to ensure alignment doesn't cause overwrites
+	TArray<NvBlastActor*>* NewActorsBuffer = &SplitNewActorsBuffer;
+	TArray<uint8>* Scratch = &SplitScratch;
+	TArray<NvBlastActor*> LocalNewActorsBuffer;
+	TArray<uint8> LocalScratch;
+	if (bSplitBuffersInUse)
+	{
+		// Damage applied from a callback while setting up the new actors below, the shared buffers are still being read
+		LocalNewActorsBuffer.SetNumUninitialized(NvBlastActorGetMaxActorCountForSplit(actor, Nv::Blast::logLL));
+		LocalScratch.SetNumUninitialized(NvBlastActorGetRequiredScratchForSplit(actor, Nv::Blast::logLL) + 0x10); // add 16 to ensure alignment doesn't cause overwrites
+		NewActorsBuffer = &LocalNewActorsBuffer;
+		Scratch = &LocalScratch;
+	}
+	else
+	{
+		// Normally a no-op since the buffers were sized from the first actor
+		UpdateSplitScratchSize(actor);
+	}
+	TGuardValue<bool> SplitBuffersGuard(bSplitBuffersInUse, true);
 
 	NvBlastActorSplitEvent splitEvent;
-	splitEvent.newActors = newActorsBuffer.GetData();
+	splitEvent.newActors = NewActorsBuffer->GetData();
 	splitEvent.deletedActor = nullptr;
 
 	uint32 parentActorIndex = NvBlastActorGetIndex(actor, Nv::Blast::logLL);
 
-	uint32 newActorsCount = NvBlastActorSplit(&splitEvent, actor, newActorsBuffer.Num(), splitScratch.GetData(),
+	uint32 newActorsCount = NvBlastActorSplit(&splitEvent, actor, NewActorsBuffer->Num(), Scratch->GetData(),
 	                                          Nv::Blast::logLL, nullptr);
 	bool bIsSplit = (splitEvent.deletedActor != nullptr);
 
@@ -2260,18 +2912,29 @@ bool UBlastMeshComponent::HandlePostDamage(NvBlastActor* actor, FName DamageType
 		FScopedSceneLock_Chaos WriteLock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Write);
 
 		BreakDownBlastActor(parentActorIndex);
+
+		// Create the bodies of all new actors in one go under this write lock. Callbacks are only fired once they all exist and the lock is released
+		FBlastActorCreateInfo CreateInfo(ParentWorldTransform);
+		CreateInfo.ParentActorLinVel = ParentLinVel;
+		CreateInfo.ParentActorAngVel = ParentAngVel;
+		CreateInfo.ParentActorCOM = ParentCOM;
+		// The NvBlastActor pointers can't be used once callbacks run, an actor destroyed by one of them leaves its pointer invalid or reused
+		TArray<TPair<uint32, uint32>, TInlineAllocator<16>> NewActorSlots;
+		NewActorSlots.Reserve(newActorsCount);
 		for (uint32 actorIdx = 0; actorIdx < newActorsCount; actorIdx++)
 		{
 			// Setup the new BlastActor, referencing the parent that was deleted.
-			FBlastActorCreateInfo CreateInfo(ParentWorldTransform);
-			CreateInfo.ParentActorLinVel = ParentLinVel;
-			CreateInfo.ParentActorAngVel = ParentAngVel;
-			CreateInfo.ParentActorCOM = ParentCOM;
-			SetupNewBlastActor(newActorsBuffer[actorIdx], CreateInfo, DamageProgram, Input, DamageType);
+			const uint32 NewActorIndex = InitNewBlastActorBody(splitEvent.newActors[actorIdx], CreateInfo);
+			NewActorSlots.Emplace(NewActorIndex, BlastActorGenerations[NewActorIndex]);
 		}
 
 		WriteLock.Release();
 
+		for (const TPair<uint32, uint32>& NewActorSlot : NewActorSlots)
+		{
+			FinishNewBlastActor(NewActorSlot.Key, NewActorSlot.Value, DamageProgram, Input, DamageType);
+		}
+
 		if (SceneLock)
 		{
 			*SceneLock = FScopedSceneLock_Chaos(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
@@ -2292,7 +2955,7 @@ void UBlastMeshComponent::OnHit(UPrimitiveComponent* HitComponent, AActor* Other
 
 	const FName& OurBoneName = Hit.Component == this ? Hit.BoneName : Hit.MyBoneName;
 	const FName& OtherBoneName = Hit.Component == this ? Hit.MyBoneName : Hit.BoneName;
-	if (OurBoneName.IsNone())
+	if (OurBoneName.IsNone() && DormantBodyInstance == nullptr)
 	{
 		UE_LOG(LogBlast, Warning,
 		       TEXT(
@@ -2300,11 +2963,8 @@ void UBlastMeshComponent::OnHit(UPrimitiveComponent* HitComponent, AActor* Other
 		       ));
 		return;
 	}
-	const int32 ActorIndex = ActorNameToActorIndex(OurBoneName);
-	if (!BlastActors.IsValidIndex(ActorIndex))
-	{
-		return;
-	}
+	// The dormant body stands in for the first actor, its body setup belongs to the mesh so it has no bone name
+	int32 ActorIndex = DormantBodyInstance ? 0 : ActorNameToActorIndex(OurBoneName);
 
 	// Look for a BlastDamageComponent on the actor that hit us.
 	UBlastBaseDamageComponent* DamageComponent = OtherActor
@@ -2316,6 +2976,33 @@ void UBlastMeshComponent::OnHit(UPrimitiveComponent* HitComponent, AActor* Other
 		DamageComponent = this->GetOwner()->FindComponentByClass<UBlastBaseDamageComponent>();
 	}
 
+	// Only create the family if this hit is going to damage it, resting contacts on a dormant component stay cheap
+	if (DormantBodyInstance)
+	{
+		bool bWillDamage = DamageComponent && DamageComponent->bDamageOnHit;
+		FBodyInstance* OtherBodyInst = OtherComp->GetBodyInstance(OtherBoneName);
+		if (!bWillDamage && UsedImpactProperties.bEnabled && OtherBodyInst)
+		{
+			FScopedSceneLock_Chaos Lock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
+
+			// Same as the impact damage below, the dormant body is kinematic so only the other mass counts
+			const FVector VelocityDelta = DormantBodyInstance->GetUnrealWorldVelocity_AssumesLocked() - OtherBodyInst->
+				GetUnrealWorldVelocity_AssumesLocked();
+			const float ImpactVelocity = FMath::Abs<float>(Hit.ImpactNormal | VelocityDelta);
+			bWillDamage = GetImpactDamageFraction(ImpactVelocity, OtherBodyInst->GetBodyMass()) > 0.f;
+		}
+		if (!bWillDamage)
+		{
+			return;
+		}
+		ActorIndex = WakeForDamage(ActorIndex);
+	}
+
+	if (!BlastActors.IsValidIndex(ActorIndex))
+	{
+		return;
+	}
+
 	// Apply Damage with DamageComponent if any
 	if (DamageComponent && DamageComponent->bDamageOnHit)
 	{
@@ -2375,19 +3062,16 @@ void UBlastMeshComponent::OnHit(UPrimitiveComponent* HitComponent, AActor* Other
 					(invWT.TransformVector(Hit.ImpactNormal)).GetSafeNormal() * ImpactImpulse * UsedStressProperties.
 					ImpactImpulseToStressImpulseFactor * ForceScale);
 
+				WaitForAsyncStressSolver(false);
 				StressSolver->addForce(*Actor, (NvcVec3&)LocalPosition, (NvcVec3&)LocalForce);
+				bStressSolverInputChanged = true;
 			}
 
 			// Apply impact impulse damage ?
 			if (UsedImpactProperties.bEnabled)
 			{
-				const float DamageImpulse = ImpactVelocity * (UsedImpactProperties.AdvancedSettings.bVelocityBased
-					                                              ? 1.0f
-					                                              : ReducedMass);
-				const float Impulse01 = FMath::Clamp<float>(
-					FMath::GetRangePct(0.f, UsedBlastMaterial.Health * UsedImpactProperties.Hardness, DamageImpulse),
-					0.f, UsedImpactProperties.AdvancedSettings.MaxDamageThreshold);
-				if (Impulse01 > UsedImpactProperties.AdvancedSettings.MinDamageThreshold)
+				const float Impulse01 = GetImpactDamageFraction(ImpactVelocity, ReducedMass);
+				if (Impulse01 > 0.f)
 				{
 					const float Damage = UsedBlastMaterial.Health * Impulse01;
 
@@ -2421,16 +3105,29 @@ void UBlastMeshComponent::OnHit(UPrimitiveComponent* HitComponent, AActor* Other
 	}
 }
 
-void UBlastMeshComponent::UpdateFractureBufferSize()
+float UBlastMeshComponent::GetImpactDamageFraction(float ImpactVelocity, float Mass) const
 {
-	UBlastAsset* BlastAsset = GetBlastAsset();
-	if (BlastMesh == nullptr)
+	const FBlastImpactDamageProperties& UsedImpactProperties = GetUsedImpactDamageProperties();
+	const float DamageImpulse = ImpactVelocity * (UsedImpactProperties.AdvancedSettings.bVelocityBased ? 1.0f : Mass);
+	const float Impulse01 = FMath::Clamp<float>(
+		FMath::GetRangePct(0.f, GetUsedBlastMaterial().Health * UsedImpactProperties.Hardness, DamageImpulse),
+		0.f, UsedImpactProperties.AdvancedSettings.MaxDamageThreshold);
+	return Impulse01 > UsedImpactProperties.AdvancedSettings.MinDamageThreshold ? Impulse01 : 0.f;
+}
+
+void UBlastMeshComponent::UpdateSplitScratchSize(const NvBlastActor* actor)
+{
+	const int32 MaxNewActors = NvBlastActorGetMaxActorCountForSplit(actor, Nv::Blast::logLL);
+	if (SplitNewActorsBuffer.Num() < MaxNewActors)
 	{
-		return;
+		SplitNewActorsBuffer.SetNumUninitialized(MaxNewActors);
 	}
 
-	FBlastFractureScratch::getInstance().ensureFractureBuffersSize(BlastAsset->GetChunkCount(),
-	                                                               BlastAsset->GetBondCount());
+	const int32 RequiredScratch = NvBlastActorGetRequiredScratchForSplit(actor, Nv::Blast::logLL) + 0x10; // add 16 to ensure alignment doesn't cause overwrites
+	if (SplitScratch.Num() < RequiredScratch)
+	{
+		SplitScratch.SetNumUninitialized(RequiredScratch);
+	}
 }
 
 void UBlastMeshComponent::AddRadialImpulse(FVector Origin, float Radius, float Strength,
@@ -2476,7 +3173,9 @@ void UBlastMeshComponent::NotifyStressSolverActorCreated(NvBlastActor& BlastActo
 {
 	if (StressSolver)
 	{
+		WaitForAsyncStressSolver(true);
 		StressSolver->notifyActorCreated(BlastActor);
+		bStressSolverInputChanged = true;
 	}
 }
 
@@ -2484,6 +3183,12 @@ void UBlastMeshComponent::SetupNewBlastActor(NvBlastActor* actor, const FBlastAc
                                              const FBlastBaseDamageProgram* DamageProgram,
                                              const FBlastBaseDamageProgram::FInput* Input, FName DamageType,
                                              bool bIsFirstActor)
+{
+	const uint32 ActorIndex = InitNewBlastActorBody(actor, CreateInfo, bIsFirstActor);
+	FinishNewBlastActor(ActorIndex, BlastActorGenerations[ActorIndex], DamageProgram, Input, DamageType);
+}
+
+uint32 UBlastMeshComponent::InitNewBlastActorBody(NvBlastActor* actor, const FBlastActorCreateInfo& CreateInfo, bool bIsFirstActor)
 {
 	uint32 actorIndex = NvBlastActorGetIndex(actor, Nv::Blast::logLL);
 
@@ -2533,11 +3238,12 @@ void UBlastMeshComponent::SetupNewBlastActor(NvBlastActor* actor, const FBlastAc
 
 	InitBodyForActor(ActorData, actorIndex, CreateInfo.Transform, GetWorld()->GetPhysicsScene(), bIsFirstActor);
 	ShowActorsVisibleChunks(actorIndex);
+	AddAwakeActor(actorIndex);
 
 	FTransform BodyWorldTransform = ActorData.BodyInstance->GetUnrealWorldTransform();
 	BodyWorldTransform.SetScale3D(ActorData.BodyInstance->Scale3D);
-	FBox AABB = ActorBodySetups[actorIndex]->AggGeom.CalcAABB(BodyWorldTransform);
-	ActorData.StartLocation = AABB.GetCenter();
+	MergeActorWorldBounds(ActorData, BodyWorldTransform);
+	ActorData.StartLocation = ActorData.WorldBounds.GetCenter();
 
 	// set velocities (passing velocities from parent actor)
 	if (!ActorData.bIsAttachedToComponent)
@@ -2551,6 +3257,19 @@ void UBlastMeshComponent::SetupNewBlastActor(NvBlastActor* actor, const FBlastAc
 
 	bAddedOrRemovedActorSinceLastRefresh = true;
 
+	return actorIndex;
+}
+
+void UBlastMeshComponent::FinishNewBlastActor(uint32 actorIndex, uint32 ActorGeneration, const FBlastBaseDamageProgram* DamageProgram,
+                                              const FBlastBaseDamageProgram::FInput* Input, FName DamageType)
+{
+	if (!IsBlastActorLive(actorIndex, ActorGeneration))
+	{
+		// Already destroyed again by a callback of one of its siblings, the slot may even hold one of its children by now
+		return;
+	}
+	FActorData& ActorData = BlastActors[actorIndex];
+
 	NotifyStressSolverActorCreated(*ActorData.BlastActor);
 
 	if (DamageProgram && Input)
@@ -2593,7 +3312,9 @@ void UBlastMeshComponent::BreakDownBlastActor(uint32 actorIndex)
 
 	if (StressSolver)
 	{
+		WaitForAsyncStressSolver(true);
 		StressSolver->notifyActorDestroyed(*ActorData.BlastActor);
+		bStressSolverInputChanged = true;
 	}
 
 	if (ActorData.TimerHandle.IsValid())
@@ -2606,13 +3327,8 @@ void UBlastMeshComponent::BreakDownBlastActor(uint32 actorIndex)
 	BroadcastOnActorDestroyed(ActorIndexToActorName(actorIndex));
 
 	HideActorsVisibleChunks(actorIndex);
-	FBodyInstance* BodyInst = ActorData.BodyInstance;
-
-	// Remove the FBodyInstance from the PhysicsScene
-	BodyInst->TermBody();
-	delete BodyInst;
-
-	ActorBodySetups[actorIndex] = nullptr;
+	RemoveAwakeActor(actorIndex);
+	ReleaseActorBody(ActorData, actorIndex);
 
 	for (const FActorChunkData& C : ActorData.Chunks)
 	{
@@ -2622,6 +3338,8 @@ void UBlastMeshComponent::BreakDownBlastActor(uint32 actorIndex)
 
 	//Reset the entry
 	ActorData = FActorData();
+	BlastActorGenerations[actorIndex]++;
+	bActorsWorldBoundsValid = false;
 
 	//Shrink the live range
 	if (actorIndex == BlastActorsBeginLive)
@@ -2643,6 +3361,138 @@ void UBlastMeshComponent::BreakDownBlastActor(uint32 actorIndex)
 	bAddedOrRemovedActorSinceLastRefresh = true;
 }
 
+UBodySetup* UBlastMeshComponent::AcquireBodySetup()
+{
+	if (BodySetupPool.Num() > 0)
+	{
+		// PopulateBodySetup clears and overwrites everything from the previous actor
+		return BodySetupPool.Pop(EAllowShrinking::No);
+	}
+	return NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+}
+
+FBodyInstance* UBlastMeshComponent::AcquireBodyInstance()
+{
+	if (BodyInstancePool.Num() > 0)
+	{
+		return BodyInstancePool.Pop(EAllowShrinking::No);
+	}
+	return new FBodyInstance();
+}
+
+void UBlastMeshComponent::ReleaseBodyToPool(FBodyInstance* BodyInst, UBodySetup* BodySetup)
+{
+	if (BodyInst)
+	{
+		// Remove the FBodyInstance from the PhysicsScene
+		BodyInst->TermBody();
+		// Reconstruct in place so nothing carries over to the next actor but the memory is kept
+		BodyInst->~FBodyInstance();
+		new (BodyInst) FBodyInstance();
+		BodyInstancePool.Add(BodyInst);
+	}
+
+	if (BodySetup)
+	{
+		BodySetup->ClearPhysicsMeshes();
+		BodySetupPool.Add(BodySetup);
+	}
+}
+
+void UBlastMeshComponent::ReleaseActorBody(FActorData& ActorData, uint32 ActorIndex)
+{
+	ReleaseBodyToPool(ActorData.BodyInstance, ActorBodySetups[ActorIndex]);
+	ActorData.BodyInstance = nullptr;
+	ActorBodySetups[ActorIndex] = nullptr;
+}
+
+FBox UBlastMeshComponent::CalcActorWorldBounds(const FActorData& ActorData, const FTransform& BodyWorldTransform) const
+{
+	// Without rotation the cached box transforms into the same tight box the shapes would give. Otherwise the box would grow
+	// with the rotation, so transform the shapes like the body's own bounds are
+	if (BodyWorldTransform.GetRotation().IsIdentity(KINDA_SMALL_NUMBER))
+	{
+		return ActorData.LocalBounds.TransformBy(BodyWorldTransform);
+	}
+
+	const TArray<FBlastCookedChunkData>& CookedData = BlastMesh->GetCookedChunkData_AssumeUpToDate();
+	FBox WorldBounds(ForceInit);
+	for (const FActorChunkData& Chunk : ActorData.Chunks)
+	{
+		if (CookedData.IsValidIndex(Chunk.ChunkIndex))
+		{
+			WorldBounds += CookedData[Chunk.ChunkIndex].AggGeom.CalcAABB(BodyWorldTransform);
+		}
+	}
+	return WorldBounds;
+}
+
+void UBlastMeshComponent::MergeActorWorldBounds(FActorData& ActorData, const FTransform& BodyWorldTransform)
+{
+	const FBox OldWorldBounds = ActorData.WorldBounds;
+	ActorData.WorldBounds = CalcActorWorldBounds(ActorData, BodyWorldTransform);
+	if (!bActorsWorldBoundsValid)
+	{
+		return;
+	}
+	if (OldWorldBounds.IsValid && !ActorData.WorldBounds.IsInsideOrOn(OldWorldBounds))
+	{
+		// The actor moved off part of its old box, which may be all that kept the union that large. Rebuilding only takes the cached boxes,
+		// otherwise flying debris would leave its whole path in the bounds
+		bActorsWorldBoundsValid = false;
+	}
+	else
+	{
+		ActorsWorldBounds += ActorData.WorldBounds;
+	}
+}
+
+void UBlastMeshComponent::AddAwakeActor(int32 ActorIndex)
+{
+	FActorData& ActorData = BlastActors[ActorIndex];
+	ActorData.bSleepPending = false;
+	if (ActorData.AwakeActorsIndex == INDEX_NONE)
+	{
+		ActorData.AwakeActorsIndex = AwakeActors.Add(ActorIndex);
+	}
+}
+
+void UBlastMeshComponent::RemoveAwakeActor(int32 ActorIndex)
+{
+	FActorData& ActorData = BlastActors[ActorIndex];
+	ActorData.bSleepPending = false;
+	if (ActorData.AwakeActorsIndex != INDEX_NONE)
+	{
+		AwakeActors.RemoveAtSwap(ActorData.AwakeActorsIndex, 1, EAllowShrinking::No);
+		if (AwakeActors.IsValidIndex(ActorData.AwakeActorsIndex))
+		{
+			BlastActors[AwakeActors[ActorData.AwakeActorsIndex]].AwakeActorsIndex = ActorData.AwakeActorsIndex;
+		}
+		ActorData.AwakeActorsIndex = INDEX_NONE;
+	}
+}
+
+void UBlastMeshComponent::DispatchWakeEvents(ESleepEvent WakeEvent, FName BoneName)
+{
+	Super::DispatchWakeEvents(WakeEvent, BoneName);
+
+	const int32 ActorIndex = ActorNameToActorIndex(BoneName);
+	if (!BlastActors.IsValidIndex(ActorIndex) || !BlastActors[ActorIndex].BodyInstance)
+	{
+		return;
+	}
+
+	if (WakeEvent == ESleepEvent::SET_Wakeup)
+	{
+		AddAwakeActor(ActorIndex);
+	}
+	else if (BlastActors[ActorIndex].AwakeActorsIndex != INDEX_NONE)
+	{
+		// The body was moving until the physics results that put it to sleep, which haven't been synced yet
+		BlastActors[ActorIndex].bSleepPending = true;
+	}
+}
+
 void UBlastMeshComponent::InitBodyForActor(FActorData& ActorData, uint32 ActorIndex,
                                            const FTransform& ParentActorWorldTransform, FPhysScene* PhysScene,
                                            bool bIsFirstActor)
@@ -2650,7 +3500,7 @@ void UBlastMeshComponent::InitBodyForActor(FActorData& ActorData, uint32 ActorIn
 	const UBlastAsset* BlastAsset = GetBlastAsset();
 	const auto& VisibleChunks = ActorData.Chunks;
 
-	UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+	UBodySetup* NewBodySetup = AcquireBodySetup();
 	check(ActorBodySetups[ActorIndex] == nullptr);
 	ActorBodySetups[ActorIndex] = NewBodySetup;
 
@@ -2658,57 +3508,33 @@ void UBlastMeshComponent::InitBodyForActor(FActorData& ActorData, uint32 ActorIn
 	NewBodySetup->BoneName = ActorIndexToActorName(ActorIndex);
 
 	const TArray<FBlastCookedChunkData>& CookedData = BlastMesh->GetCookedChunkData_AssumeUpToDate();
+	const FBlastChunkPropertyTable& ChunkProperties = BlastMesh->GetChunkProperties();
 	const NvBlastChunk* ChunkData = NvBlastAssetGetChunks(BlastAsset->GetLoadedAsset(), Nv::Blast::logLL);
 
-	float TotalVolume = 0.f;
-	const int32 ChunkCount = NvBlastAssetGetChunkCount(BlastAsset->GetLoadedAsset(), Nv::Blast::logLL);
-	for (int32 Idx = 1; Idx < FMath::Min(ChunkCount, BlastMesh->ChunkMeshVolumes.Num()); ++Idx)
-	{ 
-		TotalVolume += BlastMesh->ChunkMeshVolumes[Idx];
-	}
-	
 	bool bContainsRootChunks = false;
 	bool bIsKinematicActor = bIsFirstActor && bIsInitiallyKinematic;
 	bool bIsAllLeafChunks = true;
-	float ThisChunkVolume = 0.f;
+	float ThisChunkMassFraction = 0.f;
+	ActorData.LocalBounds.Init();
 	for (int32 i = 0; i < VisibleChunks.Num(); i++)
 	{
 		const uint32 ChunkIndex = VisibleChunks[i].ChunkIndex;
-		bContainsRootChunks |= (BlastAsset->GetChunkDepth(ChunkIndex) == 0);
+		bContainsRootChunks |= (ChunkProperties.Depths[ChunkIndex] == 0);
 		bIsKinematicActor |= BlastAsset->IsChunkStatic(ChunkIndex); // one static chunk is enough
 		bIsAllLeafChunks &= (ChunkData[ChunkIndex].firstChildIndex == ChunkData[ChunkIndex].childIndexStop);
-		if (i == 0)
-		{
-			CookedData[ChunkIndex].PopulateBodySetup(NewBodySetup);
-		}
-		else
-		{
-			CookedData[ChunkIndex].AppendToBodySetup(NewBodySetup);
-		}
-		
-		if (BlastMesh->ChunkMeshVolumes.IsValidIndex(ChunkIndex))
-		{
-			ThisChunkVolume += BlastMesh->ChunkMeshVolumes[ChunkIndex];
-		}
+		ThisChunkMassFraction += ChunkProperties.MassFractions[ChunkIndex];
+		ActorData.LocalBounds += ChunkProperties.LocalBounds[ChunkIndex];
 		checkSlow(ChunkToActorIndex[ChunkIndex] == INDEX_NONE || ChunkToActorIndex[ChunkIndex] == ActorIndex);
 		ChunkToActorIndex[ChunkIndex] = ActorIndex;
 	}
 
-	// At this point we have a UBodySetup with all of the collision from the visible chunks the actor has, so create a FBodyInstance using it and add init it.
-
-	FBodyInstance* BodyInst = new FBodyInstance();
-
 	// Check if bound to world ('glue' way to make actor kinematic)
 	if (ActorData.BlastActor != nullptr && !bIsKinematicActor)
 	{
 		bIsKinematicActor |= NvBlastActorIsBoundToWorld(ActorData.BlastActor, Nv::Blast::logLL);
 	}
 
-	if (bIsKinematicActor)
-	{
-		BodyInst->CopyBodyInstancePropertiesFrom(&BodyInstance);
-	}
-	else
+	if (!bIsKinematicActor)
 	{
 		if (bShouldAllChildrenChunksBeSmallChunks && bHasBeenFractured)
 		{
@@ -2721,22 +3547,34 @@ void UBlastMeshComponent::InitBodyForActor(FActorData& ActorData, uint32 ActorIn
 		else
 		{
 			ActorData.bIsSmallChunk =
-				NewBodySetup->AggGeom.CalcAABB(GetComponentTransform()).GetSize().Size() / 2.f <= SmallChunkRadius;
+				CalcActorWorldBounds(ActorData, GetComponentTransform()).GetSize().Size() / 2.f <= SmallChunkRadius;
 		}
-		if (ActorData.bIsSmallChunk)
+	}
+
+	for (int32 i = 0; i < VisibleChunks.Num(); i++)
+	{
+		if (i == 0)
 		{
-			BodyInst->CopyBodyInstancePropertiesFrom(&SmallChunkBodyInstance);
+			CookedData[VisibleChunks[i].ChunkIndex].PopulateBodySetup(NewBodySetup, BlastMesh->GetChunkBodySetupTemplate());
 		}
 		else
 		{
-			BodyInst->CopyBodyInstancePropertiesFrom(&DynamicChunkBodyInstance);
+			CookedData[VisibleChunks[i].ChunkIndex].AppendToBodySetup(NewBodySetup);
 		}
 	}
 
+	// Kinematic, small and dynamic actors each take their body properties from their own template
+	const FBodyInstance* BodyInstanceTemplate = bIsKinematicActor ? &BodyInstance
+		: ActorData.bIsSmallChunk ? &SmallChunkBodyInstance : &DynamicChunkBodyInstance;
+
+	// At this point we have a UBodySetup with all of the collision from the visible chunks the actor has, so create a FBodyInstance using it and add init it.
+	FBodyInstance* BodyInst = AcquireBodyInstance();
+	BodyInst->CopyBodyInstancePropertiesFrom(BodyInstanceTemplate);
+
 	// this is to ensure mass of all chunks adds up to root chunk mass
 	if (ActorIndex)
 	{
-		const float IdealChunkMass = RootChunkMass * ThisChunkVolume / TotalVolume;
+		const float IdealChunkMass = RootChunkMass * ThisChunkMassFraction;
 		BodyInst->SetMassOverride(FMath::Max(IdealChunkMass, 0.5f)); // min half kg to avoid weird physics
 	}
 	BodyInst->bSimulatePhysics = !bIsKinematicActor;
@@ -2748,6 +3586,8 @@ void UBlastMeshComponent::InitBodyForActor(FActorData& ActorData, uint32 ActorIn
 
 	BodyInst->bStartAwake = true; // Default to true - should we be taking this from higher up?
 	BodyInst->DOFMode = EDOFMode::None;
+	// Needed to keep AwakeActors up to date
+	BodyInst->bGenerateWakeEvents = true;
 
 	// we have to set this before calling InitBody and UpdateMassProperties, as there may be calls to GetBodyInstance
 	ActorData.BodyInstance = BodyInst;
@@ -2924,8 +3764,48 @@ void UBlastMeshComponent::RefreshDynamicChunkBodyInstanceFromBodyInstance()
 }
 
 
+// Bond fracture commands for the actors of one family, generated by an async stress solver update
+struct FBlastStressSolverResults
+{
+	struct FActorFracture
+	{
+		uint32 ActorIndex = 0;
+		// Set on the game thread by ApplyStressSolverResults before the first command is applied
+		uint32 ActorGeneration = 0;
+		TArray<NvBlastBondFractureData> BondFractures;
+	};
+
+	TArray<FActorFracture> Actors;
+
+	// The solver reuses its command buffers and actors change while the commands are applied, so they are copied out first
+	void CopyFractureCommands(const NvBlastActor* const* FracturedActors, const NvBlastFractureBuffers* FractureCommands, uint32 FracturedCount)
+	{
+		Actors.SetNum(FracturedCount);
+		for (uint32 Index = 0; Index < FracturedCount; Index++)
+		{
+			FActorFracture& ActorFracture = Actors[Index];
+			ActorFracture.ActorIndex = NvBlastActorGetIndex(FracturedActors[Index], Nv::Blast::logLL);
+			ActorFracture.BondFractures.Append(FractureCommands[Index].bondFractures, FractureCommands[Index].bondFractureCount);
+		}
+	}
+};
+
+static bool StressSolverSettingsEqual(const FBlastStressProperties& A, const FBlastStressProperties& B)
+{
+	return A.CompressionElasticLimit == B.CompressionElasticLimit
+		&& A.CompressionFatalLimit == B.CompressionFatalLimit
+		&& A.TensionElasticLimit == B.TensionElasticLimit
+		&& A.TensionFatalLimit == B.TensionFatalLimit
+		&& A.ShearElasticLimit == B.ShearElasticLimit
+		&& A.ShearFatalLimit == B.ShearFatalLimit
+		&& A.GraphReductionLevel == B.GraphReductionLevel;
+}
+
 void UBlastMeshComponent::TickStressSolver()
 {
+	// Results of the update started last tick are applied before anything new is fed to the solver
+	FinishAsyncStressSolverUpdate();
+
 	FVector Gravity;
 #if BLAST_USE_PHYSX
 	Gravity = GetPXScene()->getGravity();
@@ -2933,8 +3813,41 @@ void UBlastMeshComponent::TickStressSolver()
 	Gravity = GetWorld()->GetPhysicsScene()->GetSolver()->GetEvolution()->GetGravityForces().GetAcceleration(0);
 #endif
 
-	// Apply all relevant forces on actors in stress solver
+	const auto& UsedStressProperties = GetUsedStressProperties();
+	const bool bUpdateAsync = UsedStressProperties.bUpdateAsync && GetWorld()->IsGameWorld();
+
+	if (AppliedStressSolverIterations == 0 || !StressSolverSettingsEqual(AppliedStressProperties, UsedStressProperties))
+	{
+		bStressSolverInputChanged = true;
+	}
+
+	// Only actors with more than one graph node can get fracture commands, this bounds the per actor command buffers
+	uint32 StressActorCount = 0;
+
 	FScopedSceneLock_Chaos Lock(GetWorld()->GetPhysicsScene(), EPhysicsInterfaceScopedLockType::Read);
+
+	// Gravity and centrifugal forces only change when the structure moves, so a converged solver has nothing to do until then
+	const FQuat ComponentRotation = GetComponentQuat();
+	bool bStructureMoved = !ComponentRotation.Equals(StressSolverLastRotation);
+	if (!bStressSolverInputChanged && !bStructureMoved && StressSolver->converged())
+	{
+		for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive && !bStructureMoved; ActorIndex++)
+		{
+			const FActorData& ActorData = BlastActors[ActorIndex];
+			if (ActorData.BlastActor && ActorData.BodyInstance && ActorData.BodyInstance->bSimulatePhysics)
+			{
+				bStructureMoved = !FPhysicsInterface::IsSleeping(ActorData.BodyInstance->GetPhysicsActorHandle());
+			}
+		}
+
+		if (!bStructureMoved)
+		{
+			return;
+		}
+	}
+	StressSolverLastRotation = ComponentRotation;
+
+	// Apply all relevant forces on actors in stress solver
 	for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
 	{
 		FActorData& ActorData = BlastActors[ActorIndex];
@@ -2949,6 +3862,8 @@ void UBlastMeshComponent::TickStressSolver()
 			// subsupport chunks don't have graph nodes and only 1 node actor doesn't make sense to be drawn
 			continue;
 
+		StressActorCount++;
+
 		FBodyInstance* BodyInst = ActorData.BodyInstance;
 		if (BodyInst->bSimulatePhysics)
 		{
@@ -2970,18 +3885,60 @@ void UBlastMeshComponent::TickStressSolver()
 	Lock.Release();
 
 	// Stress Solver update
-	const auto& UsedStressProperties = GetUsedStressProperties();
 	{
-		Nv::Blast::ExtStressSolverSettings settings;
-		settings.compressionElasticLimit = UsedStressProperties.CompressionElasticLimit;
-		settings.compressionFatalLimit = UsedStressProperties.CompressionFatalLimit;
-		settings.tensionElasticLimit = UsedStressProperties.TensionElasticLimit;
-		settings.tensionFatalLimit = UsedStressProperties.TensionFatalLimit;
-		settings.shearElasticLimit = UsedStressProperties.ShearElasticLimit;
-		settings.shearFatalLimit = UsedStressProperties.ShearFatalLimit;
-		settings.graphReductionLevel = UsedStressProperties.GraphReductionLevel;
-		settings.maxSolverIterationsPerFrame = UsedStressProperties.MaxSolverIterationsPerFrame;
-		StressSolver->setSettings(settings);
+		// New input restarts at the full iteration count. After that iterations are halved while the error keeps dropping quickly
+		// and go back up to the maximum as soon as it stops improving
+		const uint32 MaxIterations = UsedStressProperties.MaxSolverIterationsPerFrame;
+		const uint32 MinIterations = FMath::Max(MaxIterations / 4, 1u);
+		const float StressError = StressSolver->getStressErrorLinear() + StressSolver->getStressErrorAngular();
+		uint32 Iterations = MaxIterations;
+		if (!bStressSolverInputChanged && AppliedStressSolverIterations > 0 && StressError < StressSolverLastError * 0.5f)
+		{
+			Iterations = FMath::Clamp(AppliedStressSolverIterations / 2, MinIterations, MaxIterations);
+		}
+		StressSolverLastError = StressError;
+
+		if (Iterations != AppliedStressSolverIterations || !StressSolverSettingsEqual(AppliedStressProperties, UsedStressProperties))
+		{
+			Nv::Blast::ExtStressSolverSettings settings;
+			settings.compressionElasticLimit = UsedStressProperties.CompressionElasticLimit;
+			settings.compressionFatalLimit = UsedStressProperties.CompressionFatalLimit;
+			settings.tensionElasticLimit = UsedStressProperties.TensionElasticLimit;
+			settings.tensionFatalLimit = UsedStressProperties.TensionFatalLimit;
+			settings.shearElasticLimit = UsedStressProperties.ShearElasticLimit;
+			settings.shearFatalLimit = UsedStressProperties.ShearFatalLimit;
+			settings.graphReductionLevel = UsedStressProperties.GraphReductionLevel;
+			settings.maxSolverIterationsPerFrame = Iterations;
+			StressSolver->setSettings(settings);
+
+			AppliedStressProperties = UsedStressProperties;
+			AppliedStressSolverIterations = Iterations;
+		}
+		bStressSolverInputChanged = false;
+
+		if (bUpdateAsync)
+		{
+			// The solve and command generation only read the family, fracture commands are copied out since the solver reuses its buffers
+			Nv::Blast::ExtStressSolver* Solver = StressSolver;
+			TSharedPtr<FBlastStressSolverResults, ESPMode::ThreadSafe> AsyncResults = MakeShared<FBlastStressSolverResults, ESPMode::ThreadSafe>();
+			StressSolverResults = AsyncResults;
+			StressSolverTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Solver, AsyncResults, StressActorCount]()
+			{
+				SCOPE_CYCLE_COUNTER(STAT_BlastMeshComponent_AsyncStressSolverUpdate);
+				Solver->update();
+
+				if (Solver->getOverstressedBondCount() > 0 && StressActorCount > 0)
+				{
+					TArray<const NvBlastActor*, TInlineAllocator<16>> FracturedActors;
+					TArray<NvBlastFractureBuffers, TInlineAllocator<16>> FractureCommands;
+					FracturedActors.SetNumUninitialized(StressActorCount);
+					FractureCommands.SetNumUninitialized(StressActorCount);
+					const uint32 FracturedCount = Solver->generateFractureCommandsPerActor(FracturedActors.GetData(), FractureCommands.GetData(), StressActorCount);
+					AsyncResults->CopyFractureCommands(FracturedActors.GetData(), FractureCommands.GetData(), FracturedCount);
+				}
+			});
+			return;
+		}
 
 		StressSolver->update();
 	}
@@ -2994,67 +3951,133 @@ void UBlastMeshComponent::TickStressSolver()
 	}
 #endif
 
-	// Break overstressed bonds
-	if (StressSolver->getOverstressedBondCount() > 0)
+	UpdateStressSolverOverstressRatio();
+
+	// Break overstressed bonds. The solver returns commands only for the actors that have any, in one call
+	if (StressSolver->getOverstressedBondCount() > 0 && StressActorCount > 0)
+	{
+		TArray<const NvBlastActor*, TInlineAllocator<16>> FracturedActors;
+		TArray<NvBlastFractureBuffers, TInlineAllocator<16>> FractureCommands;
+		FracturedActors.SetNumUninitialized(StressActorCount);
+		FractureCommands.SetNumUninitialized(StressActorCount);
+		const uint32 FracturedCount = StressSolver->generateFractureCommandsPerActor(FracturedActors.GetData(), FractureCommands.GetData(), StressActorCount);
+
+		FBlastStressSolverResults Results;
+		Results.CopyFractureCommands(FracturedActors.GetData(), FractureCommands.GetData(), FracturedCount);
+		ApplyStressSolverResults(Results);
+	}
+}
+
+void UBlastMeshComponent::ApplyStressSolverResults(FBlastStressSolverResults& Results)
+{
+	// All of them are live until the first one is applied, after that its split, the solver notifications and user callbacks can destroy the others
+	for (FBlastStressSolverResults::FActorFracture& ActorFracture : Results.Actors)
 	{
-		for (int32 ActorIndex = 0; ActorIndex < ActorBodySetups.Num(); ActorIndex++)
+		ActorFracture.ActorGeneration = BlastActorGenerations[ActorFracture.ActorIndex];
+	}
+
+	for (const FBlastStressSolverResults::FActorFracture& ActorFracture : Results.Actors)
+	{
+		if (ActorFracture.BondFractures.Num() == 0 || !IsBlastActorLive(ActorFracture.ActorIndex, ActorFracture.ActorGeneration))
 		{
-			FActorData& ActorData = BlastActors[ActorIndex];
-			NvBlastActor* actor = ActorData.BlastActor;
-			if (!actor)
-			{
-				continue;
-			}
+			continue;
+		}
 
-			uint32 nodeCount = NvBlastActorGetGraphNodeCount(actor, Nv::Blast::logLL);
-			if (nodeCount > 1)
-			{
-				NvBlastFractureBuffers commands;
-				StressSolver->generateFractureCommands(*actor, commands);
-				if (commands.bondFractureCount > 0)
-				{
-					FName StressDamageType(TEXT("Stress"));
-					ApplyFracture(ActorIndex, commands, StressDamageType);
-					if (commands.bondFractureCount > 0)
-					{
-						struct ImpulseOnlyDamageProgram final : public FBlastBaseDamageProgram
-						{
-							float ImpulseStrength;
-							float Radius;
+		NvBlastFractureBuffers commands;
+		commands.bondFractureCount = ActorFracture.BondFractures.Num();
+		commands.bondFractures = const_cast<NvBlastBondFractureData*>(ActorFracture.BondFractures.GetData());
+		commands.chunkFractureCount = 0;
+		commands.chunkFractures = nullptr;
+		ApplyStressFracture(ActorFracture.ActorIndex, commands);
+	}
+}
 
-							virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input,
-							                     UBlastMeshComponent& owner) const override { return false; }
+void UBlastMeshComponent::ApplyStressFracture(uint32 actorIndex, const NvBlastFractureBuffers& commands)
+{
+	if (commands.bondFractureCount > 0)
+	{
+		FActorData& ActorData = BlastActors[actorIndex];
+		NvBlastActor* actor = ActorData.BlastActor;
 
-							virtual void ExecutePostActorCreated(uint32 actorIndex, FBodyInstance* actorBody,
-							                                     const FInput& input,
-							                                     UBlastMeshComponent& owner) const override
-							{
-								actorBody->AddRadialImpulseToBody(FVector(input.worldOrigin), Radius, ImpulseStrength,
-								                                  0, true);
-							}
-						};
+		FName StressDamageType(TEXT("Stress"));
+		ApplyFracture(actorIndex, commands, StressDamageType);
 
-						if (StressProperties.SplitImpulseStrength > 0.f)
-						{
-							// Apply radial force to all new actors from the COM of parent actor
-							ImpulseOnlyDamageProgram ImpulseProgram;
-							ImpulseProgram.Radius = ActorData.BodyInstance->GetBodyBounds().GetSize().GetMax();
-							ImpulseProgram.ImpulseStrength = StressProperties.SplitImpulseStrength;
-							FBlastBaseDamageProgram::FInput ProgramInput;
-							ProgramInput.worldOrigin = FVector3f(ActorData.BodyInstance->GetCOMPosition());
-							HandlePostDamage(actor, StressDamageType, &ImpulseProgram, &ProgramInput);
-						}
-						else
-						{
-							HandlePostDamage(actor, StressDamageType);
-						}
-					}
-				}
+		struct ImpulseOnlyDamageProgram final : public FBlastBaseDamageProgram
+		{
+			float ImpulseStrength;
+			float Radius;
+
+			virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input,
+			                     UBlastMeshComponent& owner) const override { return false; }
+
+			virtual void ExecutePostActorCreated(uint32 actorIndex, FBodyInstance* actorBody,
+			                                     const FInput& input,
+			                                     UBlastMeshComponent& owner) const override
+			{
+				actorBody->AddRadialImpulseToBody(FVector(input.worldOrigin), Radius, ImpulseStrength,
+				                                  0, true);
 			}
+		};
+
+		if (StressProperties.SplitImpulseStrength > 0.f)
+		{
+			// Apply radial force to all new actors from the COM of parent actor
+			ImpulseOnlyDamageProgram ImpulseProgram;
+			ImpulseProgram.Radius = ActorData.BodyInstance->GetBodyBounds().GetSize().GetMax();
+			ImpulseProgram.ImpulseStrength = StressProperties.SplitImpulseStrength;
+			FBlastBaseDamageProgram::FInput ProgramInput;
+			ProgramInput.worldOrigin = FVector3f(ActorData.BodyInstance->GetCOMPosition());
+			HandlePostDamage(actor, StressDamageType, &ImpulseProgram, &ProgramInput);
+		}
+		else
+		{
+			HandlePostDamage(actor, StressDamageType);
 		}
 	}
 }
 
+void UBlastMeshComponent::UpdateStressSolverOverstressRatio()
+{
+	const uint32 BondCount = StressSolver ? StressSolver->getBondCount() : 0;
+	StressSolverOverstressRatio = BondCount > 0 ? static_cast<float>(StressSolver->getOverstressedBondCount()) / BondCount : 0.f;
+}
+
+void UBlastMeshComponent::FinishAsyncStressSolverUpdate()
+{
+	if (!StressSolverTask.IsValid())
+	{
+		return;
+	}
+
+	StressSolverTask.Wait();
+	StressSolverTask = UE::Tasks::FTask();
+	UpdateStressSolverOverstressRatio();
+	TSharedPtr<FBlastStressSolverResults, ESPMode::ThreadSafe> Results = MoveTemp(StressSolverResults);
+	if (!Results)
+	{
+		return;
+	}
+
+	// Anything that changed the actors since the update was started threw these results away, so they still match the current actors
+	ApplyStressSolverResults(*Results);
+}
+
+void UBlastMeshComponent::WaitForAsyncStressSolver(bool bDiscardResults)
+{
+	if (!StressSolverTask.IsValid())
+	{
+		return;
+	}
+
+	StressSolverTask.Wait();
+	if (bDiscardResults)
+	{
+		// The commands were generated for actors which may not exist anymore
+		StressSolverTask = UE::Tasks::FTask();
+		StressSolverResults.Reset();
+	}
+}
+
 void UBlastMeshComponent::UpdateDebris()
 {
 	//destroy debris with inactive timer
@@ -3087,11 +4110,12 @@ void UBlastMeshComponent::UpdateDebris(int32 ActorIndex, const FTransform& Actor
 	}
 
 	FActorData& BlastActor = BlastActors[ActorIndex];
+	const FBlastChunkPropertyTable& ChunkProperties = BlastMesh->GetChunkProperties();
 
 	//skip empty BlastActors and BlastActors with countdown to destroy
 	if (BlastActor.BodyInstance && BlastActor.Chunks.Num() && !BlastActor.TimerHandle.IsValid())
 	{
-		FBox AABB = ActorBodySetups[ActorIndex]->AggGeom.CalcAABB(ActorTransform);
+		FBox AABB = CalcActorWorldBounds(BlastActor, ActorTransform);
 		float lifetime = TNumericLimits<float>::Max();
 
 		for (const FBlastDebrisFilter& filter : debrisProp.DebrisFilters)
@@ -3102,7 +4126,7 @@ void UBlastMeshComponent::UpdateDebris(int32 ActorIndex, const FTransform& Actor
 				uint32 depth = TNumericLimits<uint32>::Max();
 				for (const FActorChunkData& ChunkData : BlastActor.Chunks)
 				{
-					depth = FMath::Min(BlastMesh->GetChunkDepth(ChunkData.ChunkIndex), depth);
+					depth = FMath::Min(ChunkProperties.Depths[ChunkData.ChunkIndex], depth);
 				}
 				isDebris &= filter.DebrisDepth <= depth;
 			}
@@ -3319,6 +4343,8 @@ void UBlastMeshComponent::DrawDebugStressGraph()
 		return;
 	}
 
+	WaitForAsyncStressSolver(false);
+
 	TArray<uint32> Nodes;
 	for (int32 ActorIndex = BlastActorsBeginLive; ActorIndex < BlastActorsEndLive; ActorIndex++)
 	{
@@ -3403,18 +4429,6 @@ void UBlastMeshComponent::DrawDebugPoint(FVector const& Position, float Size, FL
 
 #endif
 
-struct NvBlastActor* UBlastMeshComponent::CreateFirstActor()
-{
-	NvBlastActorDesc ActorDesc;
-	ActorDesc.uniformInitialBondHealth = 1.0f;
-	ActorDesc.uniformInitialLowerSupportChunkHealth = 1.0f;
-	ActorDesc.initialBondHealths = nullptr;
-	ActorDesc.initialSupportChunkHealths = nullptr;
-	TArray<uint8> Scratch;
-	Scratch.SetNumUninitialized(NvBlastFamilyGetRequiredScratchForCreateFirstActor(BlastFamily.Get(), Nv::Blast::logLL) + 0x10); // add 16 to ensure alignment bumping doesn't overwrite
-	return NvBlastFamilyCreateFirstActor(BlastFamily.Get(), &ActorDesc, Scratch.GetData(), Nv::Blast::logLL);
-}
-
 const FName UBlastMeshComponent::ActorBaseName("Actor");
 
 FPrimitiveSceneProxy* UBlastMeshComponent::CreateSceneProxy()
@@ -3506,8 +4520,7 @@ void FBlastMeshSceneProxyBase::RenderPhysicsAsset(int32 ViewIndex, FMeshElementC
 					{
 						FTransform BoneTransform = BlastMeshForDebug->GetComponentSpaceInitialBoneTransform(BoneIndex) *
 							(*BoneSpaceBases)[BoneIndex] * LocalToWorldTransform;
-						CookedChunkData[It.GetIndex()].CookedBodySetup->CreatePhysicsMeshes();
-						CookedChunkData[It.GetIndex()].CookedBodySetup->AggGeom.GetAggGeom(
+						CookedChunkData[It.GetIndex()].AggGeom.GetAggGeom(
 							BoneTransform, FColor::Orange, nullptr, false, false, false, ViewIndex, Collector);
 					}
 				}
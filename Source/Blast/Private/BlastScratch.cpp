@@ -18,10 +18,12 @@ void FBlastFractureScratch::ensureFractureBuffersSize(int32 chunkCount, int32 bo
 }
 
 
-void FBlastFractureScratch::getFractureBuffers(NvBlastFractureBuffers& buffers)
+void FBlastFractureScratch::getFractureBuffers(NvBlastFractureBuffers& buffers, int32 chunkCount, int32 bondCount)
 {
-	buffers.chunkFractureCount = ChunkFractureData.Max();
+	ensureFractureBuffersSize(chunkCount, bondCount);
+
+	buffers.chunkFractureCount = chunkCount;
 	buffers.chunkFractures = ChunkFractureData.GetData();
-	buffers.bondFractureCount = BondFractureData.Max();
+	buffers.bondFractureCount = bondCount;
 	buffers.bondFractures = BondFractureData.GetData();
 }
@@ -2,20 +2,26 @@
 #include "CoreMinimal.h"
 #include "NvBlastTypes.h"
 
+// Scratch space for NvBlastActorGenerateFracture. There is one instance per thread so fracture generation for independent
+// components can run concurrently, and each thread only grows its buffers to the largest asset it has actually processed.
 class FBlastFractureScratch
 {
 public:
 	static FBlastFractureScratch& getInstance()
 	{
-		static FBlastFractureScratch instance;
+		static thread_local FBlastFractureScratch instance;
 		return instance;
 	}
 
-	// Called when a component needs to make sure the FractureBuffers structure will fit it's data. This only ever makes the scratch space larger.
-	void ensureFractureBuffersSize(int32 chunkCount, int32 bondCount);
-	void getFractureBuffers(NvBlastFractureBuffers& buffers);
+	// Grows the scratch if required and fills buffers with exactly the capacity needed for an asset of this size
+	void getFractureBuffers(NvBlastFractureBuffers& buffers, int32 chunkCount, int32 bondCount);
 private:
+	// This only ever makes the scratch space larger
+	void ensureFractureBuffersSize(int32 chunkCount, int32 bondCount);
 
+	FBlastFractureScratch() = default;
+	FBlastFractureScratch(const FBlastFractureScratch&) = delete;
+	FBlastFractureScratch& operator=(const FBlastFractureScratch&) = delete;
 
 	TArray<NvBlastBondFractureData>				BondFractureData;
 	TArray<NvBlastChunkFractureData>			ChunkFractureData;
@@ -0,0 +1,131 @@
+#include "BlastStressSolverSubsystem.h"
+#include "BlastMeshComponent.h"
+#include "BlastModule.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BlastStressSolverSubsystem)
+
+static TAutoConsoleVariable<float> CVarBlastStressSolverBudgetMs(
+	TEXT("blast.StressSolverBudgetMs"),
+	0.f,
+	TEXT("Time in milliseconds all Blast stress solvers of a world may use per frame. At least one solver is updated every frame. 0 means no limit."));
+
+DECLARE_CYCLE_STAT(TEXT("Schedule Stress Solvers"), STAT_BlastStressSolverSubsystem_Tick, STATGROUP_Blast);
+
+void UBlastStressSolverSubsystem::Deinitialize()
+{
+	for (const FScheduledSolver& Solver : ScheduledSolvers)
+	{
+		if (UBlastMeshComponent* Component = Solver.Component.Get())
+		{
+			Component->bStressSolverScheduled = false;
+		}
+	}
+	ScheduledSolvers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UBlastStressSolverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBlastStressSolverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBlastStressSolverSubsystem, STATGROUP_Tickables);
+}
+
+void UBlastStressSolverSubsystem::RegisterComponent(UBlastMeshComponent* Component)
+{
+	check(Component);
+	if (!ScheduledSolvers.ContainsByPredicate([Component](const FScheduledSolver& Solver) { return Solver.Component == Component; }))
+	{
+		FScheduledSolver& Solver = ScheduledSolvers.AddDefaulted_GetRef();
+		Solver.Component = Component;
+	}
+	Component->bStressSolverScheduled = true;
+}
+
+void UBlastStressSolverSubsystem::UnregisterComponent(UBlastMeshComponent* Component)
+{
+	ScheduledSolvers.RemoveAllSwap([Component](const FScheduledSolver& Solver) { return Solver.Component == Component; });
+	Component->bStressSolverScheduled = false;
+}
+
+void UBlastStressSolverSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BlastStressSolverSubsystem_Tick);
+
+	ScheduledSolvers.RemoveAllSwap([](const FScheduledSolver& Solver) { return !Solver.Component.IsValid(); });
+	if (ScheduledSolvers.Num() == 0)
+	{
+		return;
+	}
+
+	const TArray<FVector>& ViewLocations = GetWorld()->ViewLocationsRenderedLastFrame;
+	// Distance at which the view no longer raises the priority, in cm
+	const float ViewFalloffDistance = 10000.f;
+
+	for (FScheduledSolver& Solver : ScheduledSolvers)
+	{
+		UBlastMeshComponent* Component = Solver.Component.Get();
+
+		// The solver runs in place of the component's tick, so it's held back the same way the tick would be
+		Solver.TimeSinceUpdate += DeltaTime;
+		Solver.bCanUpdate = Component->IsComponentTickEnabled() && Solver.TimeSinceUpdate >= Component->PrimaryComponentTick.TickInterval;
+		if (!Solver.bCanUpdate)
+		{
+			Solver.Priority = -1.f;
+			continue;
+		}
+
+		// Waiting frames count linearly so that low priority solvers are still updated round-robin style
+		Solver.Priority = Solver.FramesSinceUpdate;
+		// The further the structure is over its limits the sooner it should break. The square root keeps a few failing bonds of a large structure from being lost
+		Solver.Priority += 100.f * FMath::Sqrt(Component->StressSolverOverstressRatio);
+		if (Component->bStressSolverInputChanged)
+		{
+			Solver.Priority += 10.f;
+		}
+
+		float MinDistSquared = FLT_MAX;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistSquared = FMath::Min<float>(MinDistSquared, Component->Bounds.GetBox().ComputeSquaredDistanceToPoint(ViewLocation));
+		}
+		if (MinDistSquared < FLT_MAX)
+		{
+			Solver.Priority += 10.f * FMath::Max(1.f - FMath::Sqrt(MinDistSquared) / ViewFalloffDistance, 0.f);
+		}
+	}
+
+	ScheduledSolvers.Sort([](const FScheduledSolver& A, const FScheduledSolver& B) { return A.Priority > B.Priority; });
+
+	const double BudgetSeconds = CVarBlastStressSolverBudgetMs.GetValueOnGameThread() * 0.001;
+	const double StartTime = FPlatformTime::Seconds();
+	bool bBudgetExhausted = false;
+	for (FScheduledSolver& Solver : ScheduledSolvers)
+	{
+		if (!Solver.bCanUpdate)
+		{
+			continue;
+		}
+		if (bBudgetExhausted)
+		{
+			Solver.FramesSinceUpdate++;
+			continue;
+		}
+
+		UBlastMeshComponent* Component = Solver.Component.Get();
+		if (Component->StressSolver)
+		{
+			Component->TickStressSolver();
+		}
+		Solver.FramesSinceUpdate = 0;
+		Solver.TimeSinceUpdate = 0.f;
+
+		bBudgetExhausted = BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds;
+	}
+}
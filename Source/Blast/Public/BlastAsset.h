@@ -6,6 +6,7 @@
 #include "BlastAsset.generated.h"
 
 struct NvBlastAsset;
+class NvBlastExtDamageAccelerator;
 
 UENUM()
 enum class EBlastAssetChunkFlags : uint8
@@ -24,6 +25,13 @@ enum class EBlastMeshChunkFlags : uint8
 };
 ENUM_CLASS_FLAGS(EBlastMeshChunkFlags);
 
+UENUM()
+enum class EBlastDamageAcceleratorType : uint8
+{
+	None = 0,			// No acceleration, damage shaders test every bond and chunk of the damaged actor
+	BondAABBTree = 3	// AABB tree over the asset's bonds and chunks
+};
+
 struct FBlastEdge
 {
     uint32 S;
@@ -220,6 +228,11 @@ public:
 	*/
 	const TArray<uint32>& GetRootChunks() const;
 
+	/*
+		Get assets support chunks, the chunks of the support graph nodes
+	*/
+	const TArray<uint32>& GetSupportChunks() const { return SupportChunks; }
+
 	uint32	GetChunkCount() const;
 
 	uint32	GetBondCount() const;
@@ -249,13 +262,37 @@ public:
 
 	inline const FGuid& GetAssetGUID() const { return AssetGUID; }
 
+	/*
+		Gets the damage accelerator shared by every family created from this asset, building it on first use.
+		It's released when the last holder lets go of it. Returns null if DamageAcceleratorType is None.
+	*/
+	TSharedPtr<NvBlastExtDamageAccelerator> AcquireDamageAccelerator();
+
+	/*
+		Gets the memory of an undamaged family of this asset with its first actor already created, building it on first use.
+		New families are a copy of it instead of going through NvBlastAssetCreateFamily and NvBlastFamilyCreateFirstActor. Empty if the asset isn't loaded.
+	*/
+	const TArray<uint8>& GetPristineFamilyImage();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Acceleration structure used by the damage shaders to find the bonds and chunks inside the damage volume
+	UPROPERTY(EditAnywhere, Category = "Blast")
+	EBlastDamageAcceleratorType				DamageAcceleratorType = EBlastDamageAcceleratorType::BondAABBTree;
+
 	// NvBlastAsset serialization wrappers
 	static NvBlastAsset* DeserializeBlastAsset(const void* buffer, uint64_t bufferSize);
 	static uint64 SerializeBlastAsset(void*& buffer, const NvBlastAsset* asset);
 
+	// Creates the undamaged first actor of a new family, used for both the pristine family image and families made without it
+	static struct NvBlastActor* CreateFirstActor(struct NvBlastFamily* Family);
+
 private:
 
 	void	DeserializeRawAsset();
+	NvBlastAsset* TakeCookedLLAsset();
 	void	Update();
 
 	void	BuildChunkMaxDepth();
@@ -272,6 +309,16 @@ private:
 	*/
 	FByteBulkData							RawAssetData;
 
+	/*
+	Cooked assets store the NvBlastAsset memory block itself in RawAssetData instead of the ExtSerialization format, so it can be used without deserializing it.
+	*/
+	bool									bRawAssetDataIsLLAsset = false;
+
+#if WITH_EDITORONLY_DATA
+	// Only used to write the NvBlastAsset memory block while cooking
+	FByteBulkData							CookedLLAssetData;
+#endif
+
 	/*
 	List of asset's root chunks, updated when asset is loaded
 	*/
@@ -283,6 +330,17 @@ private:
 
 	uint32									MaxChunkDepth;
 
+	/*
+	Built from the loaded asset, reset whenever it changes. Families created before that keep the old one alive until they are released.
+	*/
+	TWeakPtr<NvBlastExtDamageAccelerator>	SharedDamageAccelerator;
+
+	/*
+	Built from the loaded asset it was made for, reset whenever the asset changes.
+	*/
+	TArray<uint8>							PristineFamilyImage;
+	const NvBlastAsset*						PristineFamilyImageAsset = nullptr;
+
 public:
 #if WITH_EDITOR
 	FBlastFractureHistory					FractureHistory;
@@ -62,6 +62,13 @@ public:
 	*/
 	virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const = 0;
 
+	/**
+	Whether Execute can be called from a worker thread to only generate fracture commands, with the commands applied later on the game thread.
+	Return 'true' only if Execute has no side effects other than calling UBlastMeshComponent::ExecuteBlastDamageProgram at most once.
+	Used by UBlastMeshComponent::ApplyDamageProgramOverlapAll to generate fracture for many actors in parallel.
+	*/
+	virtual bool CanGenerateFractureInParallel() const { return false; }
+
 	/**
 	Execute Stress program function. It is called if stress solver is enabled and give opportunity to add forces/impulses to it.
 
@@ -89,6 +96,17 @@ public:
 	*/
 	virtual FCollisionShape GetCollisionShape() const { return FCollisionShape(); }
 
+	/**
+	Whether this program does exactly the same as Other, so queued damage using either can be merged (@see UBlastMeshComponent::QueueDamageProgram).
+	By default only the same program object is. Programs overriding this should also override GetProgramTypeName.
+	*/
+	virtual bool IsSameDamageAs(const FBlastBaseDamageProgram& Other) const { return this == &Other; }
+
+	/**
+	Name of the concrete program type, used by IsSameDamageAs to check Other can be cast to the same type. Subclasses with state of their own must return their own name.
+	*/
+	virtual FName GetProgramTypeName() const { return NAME_None; }
+
 	/**
 	Damage Type is some sort of damage ID. It is passed into all damage callbacks on actor. Redefine in if you want to separate different kinds of damage.
 	*/
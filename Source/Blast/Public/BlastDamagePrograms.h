@@ -44,6 +44,8 @@ struct BLAST_API BlastRadialDamageProgram : public FBlastBaseDamageProgram
 
 	virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
 
+	virtual bool CanGenerateFractureInParallel() const override { return true; }
+
 	virtual FCollisionShape GetCollisionShape() const override
 	{
 		return FCollisionShape::MakeSphere(MaxRadius);
@@ -51,6 +53,10 @@ struct BLAST_API BlastRadialDamageProgram : public FBlastBaseDamageProgram
 
 
 	virtual void ExecutePostActorCreated(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
+
+	virtual bool IsSameDamageAs(const FBlastBaseDamageProgram& Other) const override;
+
+	virtual FName GetProgramTypeName() const override { return TEXT("BlastRadialDamageProgram"); }
 };
 
 
@@ -88,12 +94,18 @@ struct BLAST_API BlastCapsuleDamageProgram : public FBlastBaseDamageProgram
 
 	virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
 
+	virtual bool CanGenerateFractureInParallel() const override { return true; }
+
 	virtual FCollisionShape GetCollisionShape() const override
 	{
 		return FCollisionShape::MakeCapsule(MaxRadius, HalfHeight);
 	}
 
 	virtual void ExecutePostActorCreated(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
+
+	virtual bool IsSameDamageAs(const FBlastBaseDamageProgram& Other) const override;
+
+	virtual FName GetProgramTypeName() const override { return TEXT("BlastCapsuleDamageProgram"); }
 };
 
 
@@ -126,10 +138,16 @@ struct BLAST_API BlastShearDamageProgram : public FBlastBaseDamageProgram
 
 	virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
 
+	virtual bool CanGenerateFractureInParallel() const override { return true; }
+
 	virtual FCollisionShape GetCollisionShape() const override
 	{
 		return FCollisionShape::MakeSphere(MaxRadius);
 	}
 
 	virtual void ExecutePostActorCreated(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
+
+	virtual bool IsSameDamageAs(const FBlastBaseDamageProgram& Other) const override;
+
+	virtual FName GetProgramTypeName() const override { return TEXT("BlastShearDamageProgram"); }
 };
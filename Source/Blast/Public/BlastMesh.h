@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/AggregateGeom.h"
 #include "BlastAsset.h"
 #include "BlastAssetImportData.h"
 #include "BlastMaterial.h"
@@ -70,6 +71,10 @@ struct BLAST_API FBlastStressProperties
 	// Impulse multiplier if it's passed into stress solver.
 	UPROPERTY(EditAnywhere, Category = "Blast", meta = (EditCondition = "bApplyImpactImpulses"))
 	float							ImpactImpulseToStressImpulseFactor = 0.01f;
+
+	// Run the stress solver update on a worker thread, overlapping the rest of the frame. Bonds it finds overstressed are broken at the start of the next tick, so stress damage shows up one frame later.
+	UPROPERTY(EditAnywhere, Category = "Blast", meta = (EditCondition = "bCalculateStress"))
+	bool							bUpdateAsync = false;
 };
 
 USTRUCT()
@@ -305,27 +310,66 @@ struct BLAST_API FBlastCookedChunkData
 	FGuid	SourceBodySetupGUID;
 #endif
 
-	UPROPERTY(Instanced)
-	TObjectPtr<class UBodySetup> CookedBodySetup;
+	//Collision of the chunk in component space. Kept as plain data rather than a UBodySetup per chunk, large meshes would otherwise add thousands of UObjects
+	UPROPERTY()
+	FKAggregateGeom AggGeom;
+
+	UPROPERTY()
+	TObjectPtr<class UPhysicalMaterial> PhysMaterial;
 
 	UPROPERTY()
 	FVector2D MeshVolume;
 
-	FBlastCookedChunkData() : CookedBodySetup(nullptr) {}
+	//Cooked meshes of AggGeom.ConvexElems, serialized by UBlastMesh. The editor cooks them from AggGeom when the collision changed
+	TArray<Chaos::FConvexPtr> ConvexMeshes;
 
-	void PopulateBodySetup(class UBodySetup* NewBodySetup) const;
+	FBlastCookedChunkData() : PhysMaterial(nullptr) {}
+
+	bool HasCollision() const { return AggGeom.GetElementCount() > 0; }
+
+	bool HasAllConvexMeshes() const
+	{
+		if (ConvexMeshes.Num() != AggGeom.ConvexElems.Num())
+		{
+			return false;
+		}
+		for (const Chaos::FConvexPtr& ConvexMesh : ConvexMeshes)
+		{
+			if (!ConvexMesh.IsValid())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//BodySetupTemplate provides everything but the shapes, @see UBlastMesh::GetChunkBodySetupTemplate
+	void PopulateBodySetup(class UBodySetup* NewBodySetup, const class UBodySetup* BodySetupTemplate) const;
 	void AppendToBodySetup(class UBodySetup* NewBodySetup) const;
 private:
 
 	//Store these separately since the FKConvexElem class clears them on assignment so array resizes can clear them
-#if BLAST_USE_PHYSX
-	typedef TArray<physx::PxConvexMesh*, TInlineAllocator<32>> ConvexMeshTempList;
-#else
 	typedef TArray<Chaos::FConvexPtr, TInlineAllocator<32>> ConvexMeshTempList;
-#endif
 	static void UpdateAfterShapesAdded(class UBodySetup* NewBodySetup, ConvexMeshTempList ConvexMeshes);
 };
 
+/*
+	Per chunk values used over and over by the runtime when building and updating actor bodies, one array per value and indexed by chunk.
+	Derived from the cooked chunk data and the asset, so it's rebuilt whenever those change rather than serialized.
+*/
+struct FBlastChunkPropertyTable
+{
+	// Volume of the chunk's render mesh
+	TArray<float>	Volumes;
+	// Share of the root chunk's mass a body gets for this chunk, the root chunk itself is left out of the total
+	TArray<float>	MassFractions;
+	// Bounds of the chunk's collision in component space
+	TArray<FBox>	LocalBounds;
+	TArray<uint32>	Depths;
+
+	int32 Num() const { return Volumes.Num(); }
+};
+
 /*
 	This composite class represents everything required for the "Mesh" part of the Blast assets.
 
@@ -397,6 +441,7 @@ public:
 	
 	virtual void PostLoad() override;
 	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	virtual void Serialize(FArchive& Ar) override;
 
 	void RebuildIndexToBoneNameMap();
 
@@ -414,6 +459,14 @@ public:
 	const TArray<FBlastCookedChunkData>& GetCookedChunkData();
 	const TArray<FBlastCookedChunkData>& GetCookedChunkData_AssumeUpToDate() const;
 
+	// Body properties shared by all chunks, without any shapes
+	const class UBodySetup* GetChunkBodySetupTemplate() const { return ChunkBodySetupTemplate; }
+
+	const FBlastChunkPropertyTable& GetChunkProperties() const { return ChunkProperties; }
+
+	// Collision of the undamaged mesh made from the root chunks, shared by all components waiting for their first damage (@see UBlastMeshComponent::bDeferFamilyCreation)
+	class UBodySetup* GetDormantBodySetup();
+
 	static const FString ChunkPrefix;
 	static FName GetDefaultChunkBoneNameFromIndex(int32 ChunkIndex);
 protected:
@@ -422,6 +475,16 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	TArray<FBlastCookedChunkData>		CookedChunkData;
 
+	UPROPERTY(Instanced, DuplicateTransient)
+	TObjectPtr<class UBodySetup>		ChunkBodySetupTemplate;
+
+	FBlastChunkPropertyTable			ChunkProperties;
+
+	void RebuildChunkPropertyTable();
+
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<class UBodySetup>		DormantBodySetup;
+
 	//Cache this since GetComposedRefPoseMatrix is not available in non-editor builds
 	UPROPERTY()
 	TArray<FTransform>	ComponentSpaceInitialBoneTransforms;
@@ -7,6 +7,8 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "ComponentInstanceDataCache.h"
 #include "SkeletalMeshSceneProxy.h"
+#include "Containers/Queue.h"
+#include "Tasks/Task.h"
 
 #include "BlastMesh.h"
 #include "BlastAsset.h"
@@ -173,6 +175,16 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Blast")
 	bool							bBindOnHitDelegate;
 
+	// Time in milliseconds that queued damage (@see QueueDamageProgram) can take each frame. Damage that doesn't fit is applied next frame. 0 means no limit
+	UPROPERTY(EditAnywhere, Category = "Blast", meta = (ClampMin = "0", UIMin = "0"))
+	float							QueuedDamageBudgetMs;
+
+	// If true, the Blast family, damage accelerator and stress solver are only created when the component is first damaged. Until then it collides with a single
+	// kinematic body made from the root chunks, which is shared by all components using the same mesh. Only used in game worlds, when the undamaged mesh would be
+	// kinematic anyway (initially kinematic, static chunks or glued to the world) and stress is not calculated
+	UPROPERTY(EditAnywhere, Category = "Blast", AdvancedDisplay)
+	bool							bDeferFamilyCreation;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blast", meta = (PinHiddenByDefault, InlineEditConditionToggle, CantUseWithExtendedSupport))
 	bool							bOverride_BlastMaterial;
 
@@ -235,13 +247,22 @@ public:
 	void MarkDirtyOwningSuppportStructure();
 	bool HasBeenFractured() const;
 
+	// True while the component waits for its first damage to create the Blast family (@see bDeferFamilyCreation)
+	bool IsDormant() const { return DormantBodyInstance != nullptr; }
+
+	/**
+	* Creates the Blast family of a dormant component right away.
+	* @return true if the component has a Blast family afterwards
+	*/
+	bool EnsureBlastFamily();
+
 #if WITH_EDITOR
 	bool IsWorldSupportDirty() const;
 	bool IsExtendedSupportDirty() const;
 #endif
 
 	ABlastExtendedSupportStructure* GetOwningSupportStructure() const { return OwningSupportStructure; }
-	class NvBlastExtDamageAccelerator* GetAccelerator() const { return DamageAccelerator; }
+	class NvBlastExtDamageAccelerator* GetAccelerator() const { return DamageAccelerator.Get(); }
 	int32	GetOwningSupportStructureIndex() const { return OwningSupportStructureIndex; }
 
 	const FBlastMaterial& GetUsedBlastMaterial() const
@@ -407,6 +428,78 @@ public:
 	*/
 	static EBlastDamageResult ApplyDamageProgramOverlapAll(const FBlastBaseDamageProgram& DamageProgram, FVector Origin, FQuat Rot = FQuat::Identity);
 
+	/**
+	* Execute Damage Program at many origins on this component at once. Hits are grouped per live actor inside of the overlap collision shape
+	* from FBlastBaseDamageProgram, so every actor is fractured by all of its hits first and then split only once.
+	*
+	* @param DamageProgram Damage Program to be executed
+	* @param Origins Damage origins
+	* @param Rot Damage rotation used for every origin
+	* @return EBlastDamageResult Damage result enum. @see EBlastDamageResult
+	*/
+	EBlastDamageResult ApplyDamageProgramBatch(const FBlastBaseDamageProgram& DamageProgram, TArrayView<const FVector> Origins, FQuat Rot = FQuat::Identity);
+
+	/**
+	* Apply sphere-shaped damage at many origins on this component at once (e.g. shotgun pellets). BlastRadialDamageProgram is used.
+	*
+	* @param Origins Damage origins
+	* @param MinRadius Damage min radius. Damage is maximum inside of this radius.
+	* @param MinRadius Damage max radius. Damage linearly falloffs to 0 from min to max radius.
+	* @param Damage Damage value in health units, applied at each origin.
+	* @param ImpulseStrength Impulse to apply after actor splitting.
+	* @param bImpulseVelChange If true, the impulse will ignore mass of objects and will always result in a fixed velocity change.
+	* @return EBlastDamageResult Damage result enum. @see EBlastDamageResult
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Blast")
+	EBlastDamageResult ApplyRadialDamageBatch(const TArray<FVector>& Origins, float MinRadius, float MaxRadius, float Damage = 100.0f, float ImpulseStrength = 0.0f, bool bImpulseVelChange = true);
+
+	/**
+	* Apply shear damage at many origins on this component at once. BlastShearDamageProgram is used.
+	*
+	* @param Origins Damage origins
+	* @param Direction Shear direction used for every origin
+	* @param MinRadius Damage min radius. Damage is maximum inside of this radius.
+	* @param MinRadius Damage max radius. Damage linearly falloffs to 0 from min to max radius.
+	* @param Damage Damage value in health units, applied at each origin.
+	* @param ImpulseStrength Impulse to apply after actor splitting.
+	* @param bImpulseVelChange If true, the impulse will ignore mass of objects and will always result in a fixed velocity change.
+	* @return EBlastDamageResult Damage result enum. @see EBlastDamageResult
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Blast")
+	EBlastDamageResult ApplyShearDamageBatch(const TArray<FVector>& Origins, FQuat Direction, float MinRadius, float MaxRadius, float Damage = 100.0f, float ImpulseStrength = 0.0f, bool bImpulseVelChange = true);
+
+	/**
+	* Queue Damage Program to be executed on this component during its next tick. Safe to call from any thread.
+	* Queued damage with the same rotation and a program doing the same damage (@see FBlastBaseDamageProgram::IsSameDamageAs) is merged and applied with
+	* ApplyDamageProgramBatch, which splits each hit actor once per batch. Limited by QueuedDamageBudgetMs per frame.
+	* Damage that hasn't been applied yet is dropped when the family is uninitialized (Reset or physics state destroyed), use FlushQueuedDamage first to keep it.
+	*
+	* @param DamageProgram Damage Program to be executed, kept alive until it's applied
+	* @param Origin Damage origin
+	* @param Rot Damage rotation
+	*/
+	void QueueDamageProgram(TSharedRef<const FBlastBaseDamageProgram, ESPMode::ThreadSafe> DamageProgram, FVector Origin, FQuat Rot = FQuat::Identity);
+
+	/**
+	* Queue sphere-shaped damage to be applied on this component during its next tick. BlastRadialDamageProgram is used.
+	*
+	* @param Origin Damage origin
+	* @param MinRadius Damage min radius. Damage is maximum inside of this radius.
+	* @param MinRadius Damage max radius. Damage linearly falloffs to 0 from min to max radius.
+	* @param Damage Damage value in health units.
+	* @param ImpulseStrength Impulse to apply after actor splitting.
+	* @param bImpulseVelChange If true, the impulse will ignore mass of objects and will always result in a fixed velocity change.
+	* @param bRandomizeImpulse If true, we'll randomize impulses a bit
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Blast")
+	void QueueRadialDamage(FVector Origin, float MinRadius, float MaxRadius, float Damage = 100.0f, float ImpulseStrength = 0.0f, bool bImpulseVelChange = true, bool bRandomizeImpulse = false);
+
+	/**
+	* Apply all queued damage right now, ignoring QueuedDamageBudgetMs.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Blast")
+	void FlushQueuedDamage();
+
 	/**
 	* Apply sphere-shaped damage on this component. BlastRadialDamageProgram is used.
 	*
@@ -673,6 +766,7 @@ public:
 	virtual void RefreshBoneTransforms(FActorComponentTickFunction* TickFunction = NULL) override;
 
 	friend class FBlastMeshComponentInstanceData;
+	friend class UBlastStressSolverSubsystem;
 	virtual TStructOnScope<FActorComponentInstanceData> GetComponentInstanceData() const override;
 
 	//We don't actually store static lighting data, but it's a good hook to know when our glue data is out of date
@@ -697,6 +791,7 @@ protected:
 	virtual bool ShouldTickPose() const override;
 
 	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
+	virtual void DispatchWakeEvents(ESleepEvent WakeEvent, FName BoneName) override;
 
 	virtual bool OverlapComponent(const FVector& Pos, const FQuat& Rot, const FCollisionShape& CollisionShape) const override;
 	virtual bool UpdateOverlapsImpl(const TOverlapArrayView* PendingOverlaps, bool bDoNotifies, const TOverlapArrayView* OverlapsAtEndLocation) override;
@@ -719,12 +814,45 @@ protected:
 		FTimerHandle TimerHandle;
 		FVector StartLocation;
 		bool bIsSmallChunk;
-
-		FActorData() : BlastActor(nullptr), BodyInstance(nullptr), bIsAttachedToComponent(false), bIsSmallChunk(false) {}
+		// Bounds of the body's collision in body space, from the chunk property table
+		FBox LocalBounds;
+		// Bounds of the collision at the body's last synced transform, invalid until then
+		FBox WorldBounds;
+		// Position in AwakeActors, INDEX_NONE while the body can't move on its own
+		int32 AwakeActorsIndex;
+		// The body went to sleep, it's synced once more and then leaves AwakeActors
+		bool bSleepPending;
+
+		FActorData() : BlastActor(nullptr), BodyInstance(nullptr), bIsAttachedToComponent(false), bIsSmallChunk(false), LocalBounds(ForceInit), WorldBounds(ForceInit), AwakeActorsIndex(INDEX_NONE), bSleepPending(false) {}
 	};
+
 	//These are indexed by the blast actor index
 	TArray<FActorData>					BlastActors;
 	int32								BlastActorsBeginLive, BlastActorsEndLive;
+	// Bumped by BreakDownBlastActor, tells a reused actor slot apart from the actor that was there before
+	TArray<uint32>						BlastActorGenerations;
+
+	// Actors whose bodies may have moved since they were last synced, kept up to date from the physics sleep and wake events.
+	// SyncChunksAndBodies only goes over these unless bSyncAllActors is set
+	TArray<int32>						AwakeActors;
+	// Set when the bodies of resting actors also need syncing, for example because the component moved
+	bool								bSyncAllActors = true;
+
+	// Union of the WorldBounds of the live actors. New and grown actors are merged in, it's rebuilt from the cached boxes (and so can shrink)
+	// after an actor moved away from part of its old box or was removed
+	mutable FBox						ActorsWorldBounds = FBox(ForceInit);
+	mutable bool						bActorsWorldBoundsValid = false;
+	// Bounds of the actor's collision at this body transform, as tight as the bounds of the shapes themselves
+	FBox CalcActorWorldBounds(const FActorData& ActorData, const FTransform& BodyWorldTransform) const;
+	void MergeActorWorldBounds(FActorData& ActorData, const FTransform& BodyWorldTransform);
+	// Chunks whose bones were moved by SyncChunksAndBodies, their subtrees are updated from this. Only used during the sync, kept to reuse the allocation
+	TArray<uint32>						MovedBoneChunks;
+	// For each of the first chunks in MovedBoneChunks, the index of its body's component space transform in MovedBodyTransforms
+	TArray<int32>						MovedBoneChunkBodies;
+	TArray<FTransform>					MovedBodyTransforms;
+
+	void AddAwakeActor(int32 ActorIndex);
+	void RemoveAwakeActor(int32 ActorIndex);
 
 	/* The root "family" of this mesh component. */
 	TSharedPtr<struct NvBlastFamily>			BlastFamily;
@@ -732,9 +860,55 @@ protected:
 	// Stress solver 
 	Nv::Blast::ExtStressSolver* StressSolver;
 
-	class NvBlastExtDamageAccelerator* DamageAccelerator = nullptr;
+	// The stress solver sleeps while it has converged and none of its inputs changed since: forces, splits, settings or movement of the structure
+	bool bStressSolverInputChanged = true;
+	// Settings last passed to setSettings, AppliedStressSolverIterations is 0 until the first call
+	FBlastStressProperties AppliedStressProperties;
+	uint32 AppliedStressSolverIterations = 0;
+	float StressSolverLastError = 0.f;
+	FQuat StressSolverLastRotation = FQuat::Identity;
+	// Share of the solver's bonds that were over their limits after the last update, used by UBlastStressSolverSubsystem to prioritize
+	float StressSolverOverstressRatio = 0.f;
+	void UpdateStressSolverOverstressRatio();
+	// Set while UBlastStressSolverSubsystem updates the solver instead of TickComponent
+	bool bStressSolverScheduled = false;
+
+	// Stress solver update running on a worker thread when bUpdateAsync is set. It only touches StressSolver and the family, so anything on the game thread that does must wait for it first
+	UE::Tasks::FTask StressSolverTask;
+	TSharedPtr<struct FBlastStressSolverResults, ESPMode::ThreadSafe> StressSolverResults;
+
+	// Owned by the blast asset and shared with every other component using it
+	TSharedPtr<class NvBlastExtDamageAccelerator> DamageAccelerator;
+
+	// The only body of a dormant component, the Blast family doesn't exist while this is set
+	FBodyInstance* DormantBodyInstance = nullptr;
+
+	bool CanDeferFamilyCreation() const;
+	void InitBlastFamilyOrDormantBody();
+	void InitDormantBody();
+	void TermDormantBody();
+	// Creates the family if the component is dormant, returns the index of the actor that owns the overlapped body or INDEX_NONE
+	int32 WakeForDamage(int32 ItemIndex);
+
+	struct FQueuedDamage
+	{
+		TSharedPtr<const FBlastBaseDamageProgram, ESPMode::ThreadSafe> DamageProgram;
+		FVector Origin;
+		FQuat Rot;
+	};
+	// Filled from any thread by QueueDamageProgram and drained on the game thread in ProcessQueuedDamage
+	TQueue<FQueuedDamage, EQueueMode::Mpsc> QueuedDamage;
+	// Damage dequeued in a previous frame which didn't fit into the budget
+	TArray<FQueuedDamage> CarriedOverDamage;
+
+	void ProcessQueuedDamage(float BudgetMs);
 
-	EBlastDamageResult ApplyDamageOnActor(uint32 actorIndex, const FBlastBaseDamageProgram& DamageProgram, const FVector& Origin, const FQuat& Rot, struct FScopedSceneLock_Chaos* SceneLock = nullptr);
+	// Fracture commands generated ahead of time on a worker thread. When set, ExecuteBlastDamageProgram applies these instead of generating new ones.
+	struct FBlastPendingFracture* PendingFracture = nullptr;
+
+	EBlastDamageResult ApplyDamageOnActor(uint32 actorIndex, const FBlastBaseDamageProgram& DamageProgram, const FVector& Origin, const FQuat& Rot, struct FScopedSceneLock_Chaos* SceneLock = nullptr, struct FBlastPendingFracture* Pending = nullptr);
+	EBlastDamageResult ApplyDamageOnActor(uint32 actorIndex, const FBlastBaseDamageProgram& DamageProgram, TArrayView<const FVector> Origins, const FQuat& Rot, struct FScopedSceneLock_Chaos* SceneLock = nullptr, struct FBlastPendingFracture* Pending = nullptr);
+	void MakeDamageProgramInput(const FTransform& BodyWorldTransform, const FVector& Origin, const FQuat& Rot, FBlastBaseDamageProgram::FInput& OutInput) const;
 	static EBlastDamageResult ApplyDamageProgramOverlapFiltered(UBlastMeshComponent* mesh, const FBlastBaseDamageProgram& DamageProgram, const FVector& Origin, const FQuat& Rot);
 
 	void ApplyFracture(uint32 actorIndex, const struct NvBlastFractureBuffers& fractureBuffers, FName DamageType);
@@ -751,6 +925,15 @@ protected:
 
 	void NotifyStressSolverActorCreated(struct NvBlastActor& BlastActor);
 	void SetupNewBlastActor(struct NvBlastActor* actor, const FBlastActorCreateInfo& CreateInfo, const FBlastBaseDamageProgram* DamageProgram = nullptr, const FBlastBaseDamageProgram::FInput* Input = nullptr, FName DamageType = FName(), bool bIsFirstActor = false);
+	// The two halves of SetupNewBlastActor. The first creates the body and must be called with the scene write lock held, it returns the actor index.
+	// The second runs callbacks and stress solver notification, and does nothing if the actor was destroyed since, for example by a callback of a sibling
+	uint32 InitNewBlastActorBody(struct NvBlastActor* actor, const FBlastActorCreateInfo& CreateInfo, bool bIsFirstActor = false);
+	void FinishNewBlastActor(uint32 actorIndex, uint32 ActorGeneration, const FBlastBaseDamageProgram* DamageProgram, const FBlastBaseDamageProgram::FInput* Input, FName DamageType);
+	// Whether the actor at ActorIndex is still the one that was there when its generation was ActorGeneration. NvBlast reuses actor slots (and pointers)
+	bool IsBlastActorLive(uint32 ActorIndex, uint32 ActorGeneration) const
+	{
+		return BlastActors.IsValidIndex(ActorIndex) && BlastActors[ActorIndex].BlastActor != nullptr && BlastActorGenerations[ActorIndex] == ActorGeneration;
+	}
 	virtual void ShowActorsVisibleChunks(uint32 actorIndex);
 	void BreakDownBlastActor(uint32 actorIndex);
 	virtual void HideActorsVisibleChunks(uint32 actorIndex);
@@ -759,13 +942,33 @@ protected:
 		Match up the visible chunks with their physics representations
 	*/
 	bool SyncChunksAndBodies();
+	// Does the work that follows new bone transforms (child transforms, overlaps, bounds, render updates) if RefreshBoneTransforms deferred any
+	void FlushBoneRefreshSideEffects();
+	// Whether TickComponent still runs this frame, so RefreshBoneTransforms can leave its side effects to it
+	bool WillTickLaterThisFrame() const;
 
 	UFUNCTION()
 	void OnHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+	// Impact damage as a fraction of health for an impact of this speed against this mass, 0 if it's below the damage threshold
+	float GetImpactDamageFraction(float ImpactVelocity, float Mass) const;
+
+	UBodySetup* AcquireBodySetup();
+	FBodyInstance* AcquireBodyInstance();
+	void ReleaseBodyToPool(FBodyInstance* BodyInst, UBodySetup* BodySetup);
+	// Terminates the actor's body and returns it and its body setup to the pools
+	void ReleaseActorBody(FActorData& ActorData, uint32 ActorIndex);
 
-	void UpdateFractureBufferSize();
+
+	void UpdateSplitScratchSize(const struct NvBlastActor* actor);
 
 	void TickStressSolver();
+	void ApplyStressFracture(uint32 actorIndex, const struct NvBlastFractureBuffers& commands);
+	// Applies fracture commands copied out of the stress solver, skipping actors destroyed by an earlier one or its callbacks
+	void ApplyStressSolverResults(struct FBlastStressSolverResults& Results);
+	// Applies the fracture commands generated by the async stress solver update started last tick
+	void FinishAsyncStressSolverUpdate();
+	// Blocks until the async stress solver update is done. Its results are thrown away if bDiscardResults is set, e.g. when the set of actors is about to change
+	void WaitForAsyncStressSolver(bool bDiscardResults);
 
 	void UpdateDebris();
 	void UpdateDebris(int32 AcotrIndex, const FTransform& ActorTransform, struct FScopedSceneLock_Chaos* SceneLock);
@@ -783,11 +986,11 @@ protected:
 	void DrawDebugPoint(FVector const& Position, float Size, FLinearColor const& PointColor, uint8 DepthPriority = 0);
 #endif
 
-	struct NvBlastActor* CreateFirstActor();
 	bool SerializeActor(NvBlastActor* actor, TArray<uint8>& OutData);
 	NvBlastActor* DeserializeActor(const TArray<uint8>& InData, int32 DataOffset = 0);
 
-	void InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset);
+	// Returns the first actor of the new family
+	NvBlastActor* InitBlastFamilyInternal(NvBlastAsset* LLBlastAsset);
 	void InitBlastFamily();
 	void UninitBlastFamily();
 	void ShowRootChunks();
@@ -822,13 +1025,27 @@ protected:
 	};
 	DamageEventsBuffer			RecentDamageEventsBuffer;
 
+	// Reused by HandlePostDamage so splitting doesn't allocate in steady state. Sized from the first actor and only ever grown
+	TArray<struct NvBlastActor*>	SplitNewActorsBuffer;
+	TArray<uint8>					SplitScratch;
+	bool							bSplitBuffersInUse = false;
+
 	//These are stored in the body instance by a weak pointer so we keep a reference here to keep them alive
 	UPROPERTY(Transient, DuplicateTransient)
 	TArray<TObjectPtr<UBodySetup>>	ActorBodySetups;
 
+	// Body setups and body instances of destroyed actors, reused by InitBodyForActor so splitting doesn't churn allocations and GC
+	UPROPERTY(Transient, DuplicateTransient)
+	TArray<TObjectPtr<UBodySetup>>	BodySetupPool;
+	TArray<FBodyInstance*>			BodyInstancePool;
+
 	bool						bAddedOrRemovedActorSinceLastRefresh;
 	bool						bChunkVisibilityChanged;
 	bool						bHasBeenFractured;
+	// RefreshBoneTransforms changed the bones but FlushBoneRefreshSideEffects hasn't run since
+	bool						bBoneRefreshSideEffectsPending = false;
+	// GFrameCounter when TickComponent last finished
+	uint64						LastTickFrame = 0;
 
 	class FBlastMeshSceneProxyBase* BlastProxy;
 
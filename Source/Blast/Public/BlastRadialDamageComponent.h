@@ -11,6 +11,7 @@ class UBlastRadialDamageComponent;
 struct RadialDamageProgramWithForce final : public FBlastBaseDamageProgram
 {
 	virtual bool Execute(uint32 actorIndex, FBodyInstance* actorBody, const FInput& input, UBlastMeshComponent& owner) const override;
+	virtual bool CanGenerateFractureInParallel() const override { return true; }
 	virtual void ExecutePostSplit(const FInput& input, UBlastMeshComponent& owner) const override;
 	virtual FCollisionShape GetCollisionShape() const override;
 
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BlastStressSolverSubsystem.generated.h"
+
+class UBlastMeshComponent;
+
+//Owns the stress solver update schedule of every UBlastMeshComponent in a game world. Each frame the components are updated in priority order
+//(share of overstressed bonds, pending damage, distance to the views, frames since the last update) until blast.StressSolverBudgetMs is used up.
+//The ones that didn't fit wait for a later frame, so every component gets its turn eventually. Components with their tick disabled are skipped
+//and a TickInterval is respected like TickComponent would.
+UCLASS()
+class BLAST_API UBlastStressSolverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	//~ Begin UWorldSubsystem Interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~ End UWorldSubsystem Interface
+
+public:
+	void RegisterComponent(UBlastMeshComponent* Component);
+	void UnregisterComponent(UBlastMeshComponent* Component);
+
+private:
+	struct FScheduledSolver
+	{
+		TWeakObjectPtr<UBlastMeshComponent> Component;
+		uint32 FramesSinceUpdate = 0;
+		float TimeSinceUpdate = 0.f;
+		float Priority = 0.f;
+		bool bCanUpdate = false;
+	};
+
+	TArray<FScheduledSolver> ScheduledSolvers;
+};
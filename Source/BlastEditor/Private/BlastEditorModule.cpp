@@ -359,7 +359,7 @@ public:
 				TArray<FBlastCollisionHull>& NewUEHulls = NewCombinedHulls.Last();
 
 				UBodySetup* TempBodySetup = NewObject<UBodySetup>();
-				TempBodySetup->AggGeom = CookedChunkData[Chunk].CookedBodySetup->AggGeom;
+				TempBodySetup->AggGeom = CookedChunkData[Chunk].AggGeom;
 
 				auto& ConvexList = TempBodySetup->AggGeom.ConvexElems;
 				//Convert boxes to convex
@@ -1119,6 +1119,7 @@ EEditorBuildResult FBlastEditorModule::DoBlastBuild(UWorld* World, FName Step)
 			check(LLModifiedAsset);
 
 			UBlastAsset* NewModifiedAsset = NewObject<UBlastAsset>(BlastComponent);
+			NewModifiedAsset->DamageAcceleratorType = Asset->DamageAcceleratorType;
 			//Use the same GUID as our non-modified asset so we can tell if it changes later
 			NewModifiedAsset->CopyFromLoadedAsset(LLModifiedAsset, Asset->GetAssetGUID());
 			NVBLAST_FREE(LLModifiedAsset);
@@ -1230,7 +1231,7 @@ bool FBlastEditorModule::BuildExtendedSupport(ABlastExtendedSupportStructure* Ex
 			TArray<FBlastCollisionHull>& NewUEHulls = NewCombinedHulls.Last();
 
 			UBodySetup* TempBodySetup = NewObject<UBodySetup>();
-			TempBodySetup->AggGeom = CookedChunkData[Chunk].CookedBodySetup->AggGeom;
+			TempBodySetup->AggGeom = CookedChunkData[Chunk].AggGeom;
 
 			auto& ConvexList = TempBodySetup->AggGeom.ConvexElems;
 			//Convert boxes to convex